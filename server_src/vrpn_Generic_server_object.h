@@ -7,6 +7,13 @@
 #include "vrpn_Types.h"                 // for vrpn_float64
 
 class vrpn_MainloopContainer;
+class vrpn_Device_Thread;
+class VRPN_API vrpn_Poller;
+struct vrpn_Generic_Server_Startup;
+struct vrpn_Generic_Server_Pending;
+struct vrpn_Generic_Server_Config;
+struct vrpn_Generic_Server_Entry;
+struct VRPN_API vrpn_ThreadData;
 
 const int VRPN_GSO_MAX_NDI_POLARIS_RIGIDBODIES = 20; //FIXME find out from the NDI specs if there is a maximum;
 
@@ -16,10 +23,35 @@ class VRPN_API vrpn_PA_axis;
 class vrpn_Generic_Server_Object
 {
   public:
-    vrpn_Generic_Server_Object (vrpn_Connection *connection_to_use, const char *config_file_name = "vrpn.cfg", int port = vrpn_DEFAULT_LISTEN_PORT_NO, bool be_verbose = false, bool bail_on_open_error = false);
+    /// If thread_every_device is true, each device runs its mainloop() on
+    /// a thread of its own (see vrpn_Device_Thread.h);  otherwise only the
+    /// ones whose vrpn.cfg lines start with vrpn_Device_Thread do.
+    /// If init_threads is more than zero, that many threads build and
+    /// reset the devices, and each is handed to the connection from
+    /// mainloop() as soon as it and the ones above it in the file are
+    /// ready;  a report of how long each took is printed at the end.
+    vrpn_Generic_Server_Object (vrpn_Connection *connection_to_use, const char *config_file_name = "vrpn.cfg", int port = vrpn_DEFAULT_LISTEN_PORT_NO, bool be_verbose = false, bool bail_on_open_error = false, bool thread_every_device = false, int init_threads = 0);
     ~vrpn_Generic_Server_Object();
 
     void mainloop (void);
+
+    /// Tells the poller what should wake the devices;  false if some of
+    /// them can't say (see vrpn_Poller.h).
+    bool wake_sources (vrpn_Poller & poller);
+
+    /// Reads the configuration file again.  Devices whose entries have not
+    /// changed keep running, and the clients using them notice nothing;
+    /// the devices for entries that are new or changed are started on the
+    /// connection, which tells connected clients about their senders, and
+    /// those for entries that have gone are closed.  A changed entry
+    /// closes the device of the same name before its new one starts.
+    /// Returns 0 if every entry could be started.
+    int reload (void);
+
+    /// Calls reload() by itself whenever the configuration file is written
+    /// (Linux, using inotify).  Returns false if it can't watch the file.
+    bool watch_config_file (void);
+
     inline bool doing_okay (void) const {
       return d_doing_okay;
     }
@@ -35,6 +67,48 @@ class vrpn_Generic_Server_Object
 
     void closeDevices (void);
 
+    // Devices on threads of their own.  Between begin_device() and
+    // end_device(), the setup functions below see the thread's connection
+    // and device list as connection and _devices.
+    bool d_thread_every_device;
+    vrpn_Device_Thread * d_device_thread;   //< Being set up, or NULL
+    vrpn_Connection * d_server_connection;
+    vrpn_MainloopContainer * d_server_devices;
+    void begin_device (bool threaded);
+    int end_device (int setup_result);
+
+    // Entries of the configuration file and the devices each one started,
+    // so that reload() can tell which have changed.
+    vrpn_Generic_Server_Config * d_config;
+    vrpn_Generic_Server_Entry * d_reading_entry;  //< Being set up, or NULL
+    int next_entry (FILE * config_file, char * line, char * raw, bool & threaded);
+    int add_entry (FILE * config_file, char * line, const char * raw, bool threaded);
+    int setup_line (char * line, FILE * config_file, bool threaded);
+    bool same_entry (vrpn_Generic_Server_Entry * entry, const char * raw, FILE * config_file);
+    void close_entry (vrpn_Generic_Server_Entry * entry);
+    void check_config_file (void);
+
+    typedef int (vrpn_Generic_Server_Object::*Setup_Function) (char * & pch, char * line, FILE * config_file);
+
+    // Devices started in parallel (init_threads).  Each entry in the file
+    // is built on a vrpn_Device_Thread of its own, by a startup thread or
+    // (if its setup function reads more lines from the file) right away
+    // by this one;  a startup thread then runs one mainloop() on it,
+    // which is when most drivers reset their hardware.  finish_devices()
+    // starts the ready ones in the order of the file, so the names are
+    // registered on the connection in the same order as without threads.
+    friend struct vrpn_Generic_Server_Pending;
+    vrpn_Generic_Server_Startup * d_startup;  //< NULL once all have started
+    vrpn_Generic_Server_Object (vrpn_Device_Thread * thread, bool be_verbose);
+      //< Builds devices on the thread's connection and list.
+    int setup_device (Setup_Function setup, char * pch, char * scrap, char * line, FILE * config_file, bool threaded, bool in_order);
+    int queue_device (Setup_Function setup, char * pch, char * scrap, char * line, FILE * config_file, bool threaded, bool in_order);
+    void build_device (vrpn_Generic_Server_Pending * dev, FILE * config_file);
+    void finish_devices (void);
+    void report_startup (void);
+    void stop_startup (void);
+    static void startup_thread (vrpn_ThreadData & threadData);
+
     // Helper functions for the functions below
     int get_AFline (char *line, vrpn_TAF_axis *axis);
     int	get_poser_axis_line (FILE *config_file, const char *axis_name, vrpn_PA_axis *axis, vrpn_float64 *min, vrpn_float64 *max);
@@ -71,6 +145,10 @@ class vrpn_Generic_Server_Object
     int setup_Tracker_Flock (char * & pch, char * line, FILE * /*config_file*/);
     int setup_Tracker_Flock_Parallel (char * & pch, char * line, FILE * /*config_file*/);
     int setup_Tracker_NULL (char * & pch, char * line, FILE * /*config_file*/);
+    int setup_Tracker_Synthetic (char * & pch, char * line, FILE * /*config_file*/);
+    int setup_Analog_Synthetic (char * & pch, char * line, FILE * /*config_file*/);
+    int setup_Button_Synthetic (char * & pch, char * line, FILE * /*config_file*/);
+    int setup_Imager_Synthetic (char * & pch, char * line, FILE * /*config_file*/);
     int setup_Button_Python (char * & pch, char * line, FILE * /*config_file*/);
     int setup_Button_SerialMouse (char * & pch, char * line, FILE * /*config_file*/);
     int setup_Button_PinchGlove (char* &pch, char *line, FILE *config_file);
@@ -115,7 +193,7 @@ class vrpn_Generic_Server_Object
     int setup_Freespace (char * & pch, char * line, FILE * /*config_file*/);
     int setup_Tracker_NovintFalcon (char * & pch, char * line, FILE * /*config_file*/);
     int setup_Tracker_TrivisioColibri (char * &pch, char * line, FILE * /*config_file*/);
-    int setup_Tracker_GameTrak (char *pch, char *line, FILE * config_file);
+    int setup_Tracker_GameTrak (char * &pch, char *line, FILE * config_file);
     int setup_LUDL_USBMAC6000 (char * &pch, char * line, FILE * /*config_file*/);
     int setup_Analog_5dtUSB_Glove5Left (char * &pch, char * line, FILE * /*config_file*/);
     int setup_Analog_5dtUSB_Glove5Right (char * &pch, char * line, FILE * /*config_file*/);
@@ -153,6 +153,10 @@ SOURCE=.\vrpn_Connection.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Device_Thread.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Dial.C
 # End Source File
 # Begin Source File
@@ -222,6 +226,10 @@ SOURCE=.\vrpn_ForwarderController.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Frame_Parser.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_FunctionGenerator.C
 # End Source File
 # Begin Source File
@@ -266,6 +274,14 @@ SOURCE=.\vrpn_LamportClock.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_LogCompression.C
+# End Source File
+# Begin Source File
+
+SOURCE=.\vrpn_LogIndex.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Magellan.C
 # End Source File
 # Begin Source File
@@ -274,6 +290,10 @@ SOURCE=.\vrpn_Mouse.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_MultiFileConnection.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Mutex.C
 # End Source File
 # Begin Source File
@@ -286,6 +306,10 @@ SOURCE=.\vrpn_nikon_controls.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Poller.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Poser.C
 # End Source File
 # Begin Source File
@@ -306,6 +330,10 @@ SOURCE=.\vrpn_RedundantTransmission.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Reset_Steps.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Serial.C
 # End Source File
 # Begin Source File
@@ -326,6 +354,10 @@ SOURCE=.\vrpn_Spaceball.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Synthetic.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Text.C
 # End Source File
 # Begin Source File
@@ -490,6 +522,10 @@ SOURCE=.\vrpn_Connection.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Device_Thread.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Dial.h
 # End Source File
 # Begin Source File
@@ -550,6 +586,10 @@ SOURCE=.\vrpn_ForwarderController.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Frame_Parser.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_FunctionGenerator.h
 # End Source File
 # Begin Source File
@@ -618,6 +658,10 @@ SOURCE=.\vrpn_nikon_controls.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Poller.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Poser.h
 # End Source File
 # Begin Source File
@@ -638,6 +682,10 @@ SOURCE=.\vrpn_RedundantTransmission.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Reset_Steps.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Serial.h
 # End Source File
 # Begin Source File
@@ -658,6 +706,10 @@ SOURCE=.\vrpn_Spaceball.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Synthetic.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Text.h
 # End Source File
 # Begin Source File
@@ -2,6 +2,7 @@
 #define SPACE_H
 
 #include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Frame_Parser.h"          // for vrpn_Frame_Parser
 #include "vrpn_Tracker.h"               // for vrpn_Tracker_Serial
 
 class VRPN_API vrpn_Connection;
@@ -12,7 +13,8 @@ class VRPN_API vrpn_Tracker_3Space: public vrpn_Tracker_Serial {
   
   vrpn_Tracker_3Space(char *name, vrpn_Connection *c,
 		      const char *port = "/dev/ttyS1", long baud = 19200) :
-  vrpn_Tracker_Serial(name,c,port,baud) {};
+  vrpn_Tracker_Serial(name,c,port,baud), reset_len(0), reset_sent(0),
+  d_frames(frame_format()) {};
     
  protected:
   
@@ -21,6 +23,13 @@ class VRPN_API vrpn_Tracker_3Space: public vrpn_Tracker_Serial {
 
   virtual void reset();
 
+  unsigned char reset_string[10];	//< Characters reset() is sending, one at a time
+  int	reset_len;			//< How many there are
+  int	reset_sent;			//< How many have been sent so far
+
+  vrpn_Frame_Parser d_frames;		//< Finds the reports in what is read
+  static vrpn_Frame_Format frame_format(void);
+
 };
 
 #endif
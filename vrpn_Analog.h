@@ -6,6 +6,7 @@
 #include "vrpn_BaseClass.h"             // for vrpn_Callback_List, etc
 #include "vrpn_Configure.h"             // for VRPN_API, VRPN_CALLBACK
 #include "vrpn_Connection.h"            // for vrpn_CONNECTION_LOW_LATENCY, etc
+#include "vrpn_Reset_Steps.h"           // for vrpn_Reset_Steps
 #include "vrpn_Shared.h"                // for timeval
 #include "vrpn_Types.h"                 // for vrpn_int32, vrpn_float64, etc
 
@@ -72,6 +73,10 @@ protected:
   unsigned char buffer[1024];
   int bufcounter;
 
+  /// For drivers whose reset has to wait on the device:  do one step per
+  /// pass through mainloop() rather than sleeping.  See vrpn_Reset_Steps.
+  vrpn_Reset_Steps reset_steps;
+
   int read_available_characters(char *buffer, int bytes);
 };
 #endif
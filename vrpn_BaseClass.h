@@ -128,6 +128,7 @@ class VRPN_API vrpn_TextPrinter {
     FILE		*d_ostream;		///< Output stream to use
     vrpn_TEXT_SEVERITY	d_severity_to_print;	///< Minimum severity to print
     vrpn_uint32		d_level_to_print;	///< Minimum level to print
+    vrpn_Semaphore	d_lock;			///< Guards the list of objects
 
     /// Handles the text messages that come from the connections for
     /// objects we are watching.
@@ -151,6 +152,13 @@ class VRPN_API vrpn_BaseClassUnique {
 
 	bool shutup;	// if True, don't print the "No response from server" messages.
 
+	/// Tells the poller what should wake a server that is waiting for this
+	/// device to have something to do:  the descriptors it reads and when
+	/// its next timed report is due (see vrpn_Poller.h).  Returns false,
+	/// the default, if the device can't say; the server then calls its
+	/// mainloop() at a fixed rate as it always has.
+	virtual bool wake_sources(vrpn_Poller &) { return false; }
+
 	friend class SendTextMessageBoundCall;
 	class SendTextMessageBoundCall {
 		private:
@@ -124,6 +124,9 @@ public:
 
 	virtual void mainloop();
 
+	/// Wakes the server when the buttons are next due to toggle.
+	virtual bool wake_sources(vrpn_Poller & poller);
+
 protected:
 	vrpn_float64	_update_rate;	// How often to toggle
 };
@@ -204,6 +207,10 @@ protected:
    unsigned char buffer[VRPN_BUTTON_BUF_SIZE]; // char read from the button so far
    vrpn_uint32 bufcount; // number of char in the buffer
 
+   /// For drivers whose reset has to wait on the device:  do one step per
+   /// pass through mainloop() rather than sleeping.  See vrpn_Reset_Steps.
+   vrpn_Reset_Steps reset_steps;
+
    virtual void read()=0;
 };
 
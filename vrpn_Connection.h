@@ -33,6 +33,7 @@ enum vrpn_ConnectionStatus {LISTEN             = (1),
                        LOGGING            = (-4)};
 
 class VRPN_API	vrpn_File_Connection;  // Forward declaration for get_File_Connection()
+class VRPN_API	vrpn_Poller;
 
 /// @brief This structure is what is passed to a vrpn_Connection message callback.
 ///
@@ -206,6 +207,10 @@ class VRPN_API vrpn_Endpoint {
     /// Returns the local mapping for the remote sender (-1 if none).
     int local_sender_id (vrpn_int32 remote_sender) const;
 
+    /// Returns the minor version of VRPN that the other side sent in its
+    /// cookie (see vrpn_cookie_minor_version()), or 0 if it has not.
+    int remote_minor_version (void) const { return d_remoteMinorVersion; }
+
     virtual vrpn_bool doing_okay (void) const = 0;
     /// @}
 
@@ -350,6 +355,8 @@ class VRPN_API vrpn_Endpoint {
     vrpn_int32 * d_connectionCounter;
 
     vrpn_Connection * d_parent;
+
+    int d_remoteMinorVersion;	///< From the other side's cookie
 };
 
 /// @brief Encapsulation of the data and methods for a single IP-based connection
@@ -398,6 +405,11 @@ class VRPN_API vrpn_Endpoint_IP : public vrpn_Endpoint {
     /// to send out intermediate results without calling mainloop
     virtual int send_pending_reports (void);
 
+    /// Tells the poller about the sockets this endpoint reads, whether
+    /// it has messages waiting to go out and, while it is trying to
+    /// connect, when it next tries again.
+    void wake_sources (vrpn_Poller & poller);
+
     int pack_udp_description (int portno);
 
     int handle_tcp_messages (const timeval * timeout);
@@ -543,6 +555,11 @@ class VRPN_API vrpn_Connection {
     /// and this timeout will be divided evenly between them.
     virtual int mainloop (const struct timeval * timeout = NULL) = 0;
 
+    /// Tells the poller what should wake a server waiting on this
+    /// connection (see vrpn_Poller.h).  Returns false if the connection
+    /// can't say, in which case mainloop() should be called regularly.
+    virtual bool wake_sources (vrpn_Poller &) { return false; }
+
     /// Get a token to use for the string name of the sender or type.
     /// Remember to check for -1 meaning failure.
     virtual vrpn_int32 register_sender (const char * name);
@@ -566,6 +583,25 @@ class VRPN_API vrpn_Connection {
 	    vrpn_int32 type, vrpn_int32 sender, const char * buffer,
 	    vrpn_uint32 class_of_service);
 
+    /// Pack a message only for the endpoints whose other side runs at
+    /// least the given minor version of VRPN (if newer is TRUE) or an
+    /// older one (if newer is FALSE).  A device can use this to send a
+    /// message that older peers do not understand to the newer ones and
+    /// the older messages to the rest.  Handlers in this process, and
+    /// endpoints that are only logging, are treated as older peers.
+    virtual int pack_message_for_version(vrpn_uint32 len,
+	    struct timeval time, vrpn_int32 type, vrpn_int32 sender,
+	    const char * buffer, vrpn_uint32 class_of_service,
+	    int minor_version, vrpn_bool newer);
+
+    /// Whether any connected endpoint's other side runs at least the
+    /// given minor version of VRPN.
+    virtual vrpn_bool has_peer_version (int minor_version) const;
+
+    /// The highest minor version of VRPN run by the other side of any
+    /// connected endpoint, or -1 if nothing is connected.
+    int highest_peer_version (void) const;
+
     /// send pending report, clear the buffer.
     /// This function was protected, now is public, so we can use it
     /// to send out intermediate results without calling mainloop
@@ -597,6 +633,30 @@ class VRPN_API vrpn_Connection {
     /// Save any messages on any endpoints which have been logged so far.
     virtual int save_log_so_far();
 
+    /// @brief Turns on continuous-capture log rotation for every log on
+    /// this connection, including incoming logs for clients that connect
+    /// later.  A new file is started every max_bytes bytes or max_seconds
+    /// seconds (zero disables either limit), and if keep_files is nonzero
+    /// only that many of the most recent files are kept.  See
+    /// vrpn_Log::setRotation().
+    virtual int set_log_rotation (vrpn_uint32 max_bytes,
+                                  vrpn_uint32 max_seconds,
+                                  vrpn_uint32 keep_files = 0);
+
+    /// @brief Has every log on this connection save a time index next
+    /// to each log file it writes (see vrpn_Log::setIndexing()), so that
+    /// playback can seek without scanning the log.
+    virtual int set_log_indexing (vrpn_bool on);
+
+    /// @brief Has every log on this connection write block-compressed
+    /// log files (see vrpn_Log::setCompression()).
+    virtual int set_log_compression (vrpn_bool on);
+
+    /// @brief Has every log on this connection put what it has logged on
+    /// the disk at most every msecs milliseconds, so that a crash loses
+    /// no more than that (see vrpn_Log::setSyncInterval()).
+    virtual int set_log_sync_interval (vrpn_uint32 msecs);
+
     /// vrpn_File_Connection implements this as "return this" so it
     /// can be used to detect a File_Connection and get the pointer for it
     virtual vrpn_File_Connection * get_File_Connection (void);
@@ -735,6 +795,14 @@ class VRPN_API vrpn_Connection {
     vrpn_int32 d_serverLogMode;
     char * d_serverLogName;
 
+    /// Settings from set_log_rotation(), applied to new endpoints' logs.
+    vrpn_uint32 d_logRotateBytes;
+    vrpn_uint32 d_logRotateSeconds;
+    vrpn_uint32 d_logRotateKeep;
+    vrpn_bool d_logIndexing;      ///< Setting from set_log_indexing()
+    vrpn_bool d_logCompress;      ///< Setting from set_log_compression()
+    vrpn_uint32 d_logSyncMsecs;   ///< Setting from set_log_sync_interval()
+
     vrpn_Endpoint_IP * (* d_endpointAllocator) (vrpn_Connection *,
                                              vrpn_int32 *);
     vrpn_bool d_updateEndpoint;
@@ -799,6 +867,8 @@ class VRPN_API vrpn_Connection_IP : public vrpn_Connection {
     /// and this timeout will be divided evenly between them.
     virtual int mainloop (const struct timeval * timeout = NULL);
 
+    virtual bool wake_sources (vrpn_Poller & poller);
+
   protected:
 
     /// If this value is greater than zero, the connection should stop
@@ -867,6 +937,8 @@ class VRPN_API vrpn_Connection_IP : public vrpn_Connection {
 /// If no IP address for the NIC to use is specified, uses the default
 /// NIC.  If the force_reopen flag is set, a new connection will be
 /// made even if there was already one to that server.
+/// Several file: names separated by '|' characters open a
+/// vrpn_Multi_File_Connection that plays the files back together.
 /// When done with the object, call removeReference() on it (which will
 /// delete it if there are no other references).
 VRPN_API vrpn_Connection * vrpn_get_connection_by_name (
@@ -972,6 +1044,10 @@ VRPN_API int vrpn_cookie_size (void);
 
 VRPN_API int write_vrpn_cookie (char * buffer, int length, long remote_log_mode);
 
+/// @brief Returns the minor version number in a cookie (the number after
+/// the last period of its vrpn_MAGIC), or -1 if there is none.
+VRPN_API int vrpn_cookie_minor_version (const char * buffer);
+
 /// @name Utility routines for reading from and writing to sockets/file descriptors
 /// @{
 #ifndef VRPN_USE_WINSOCK_SOCKETS
@@ -1043,6 +1119,9 @@ class VRPN_API vrpn_ConnectionManager {
       /// @brief unnamed (server) connections
     knownConnection * d_anonList;
 
+      /// @brief guards both lists;  connections may be made on any thread
+    vrpn_Semaphore d_lock;
+
     vrpn_ConnectionManager (void);
 
       // @brief copy constructor undefined to prevent instantiations
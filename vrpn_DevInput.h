@@ -50,11 +50,18 @@ public:
 
     virtual void mainloop();
 
+    /// Wakes the server when there is an input event to read.
+    virtual bool wake_sources(vrpn_Poller & poller);
+
 protected:  // methods
-    /// Try to read reports from the device.
-    /// Returns 1 if msg received, or 0 if none received.
+    /// Reads all of the events waiting on the device, sending a report
+    /// at the end of each frame of them.  Returns the number of frames.
     virtual int get_report();
 
+    /// Reads the key and axis state from the device after the kernel
+    /// dropped events.
+    void resync_state();
+
     /// send report iff changed
     virtual void report_changes( vrpn_uint32 class_of_service
 		    = vrpn_CONNECTION_LOW_LATENCY );
@@ -75,6 +82,7 @@ private:  // disable unwanted default methods
     int d_fileDescriptor;
     vrpn_float64 d_absolute_min;
     vrpn_float64 d_absolute_range;
+    bool d_dropped;		///< Skipping the rest of a frame with dropped events
 };
 
 #endif
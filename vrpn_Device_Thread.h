@@ -0,0 +1,124 @@
+#ifndef VRPN_DEVICE_THREAD_H
+#define VRPN_DEVICE_THREAD_H
+
+// vrpn_Device_Thread
+//
+// Runs the mainloop() of one or more devices on a thread of their own,
+// so that a driver that stalls (a serial tracker waiting on a read, a HID
+// device being reopened) no longer holds up every other device in the
+// server.  vrpn_Generic_Server_Object uses it for devices marked for it
+// in vrpn.cfg.
+//
+// The devices are built on connection(), a stand-in for the server's
+// connection that belongs to the thread once start() has been called.
+// Whatever the devices pack on it is collected in a batch that is handed
+// to the server's connection, translated by sender and type name, when
+// the server calls mainloop() on this object.  Messages for the devices'
+// senders and types (pings, requests from clients, reports from devices
+// they listen to) go the other way.  Handing a batch over only swaps two
+// buffers under a semaphore, so neither side waits on the other's work.
+//
+// Where threads are not available, or when start() is told not to use
+// one, mainloop() runs the devices itself.  vrpn_Generic_Server_Object
+// does that with devices it has built away from the server's connection
+// (see -init_threads in vrpn_server) but that don't need a thread to run.
+
+#include "vrpn_Configure.h"             // for VRPN_API, VRPN_CALLBACK
+#include "vrpn_Connection.h"            // for vrpn_HANDLERPARAM, etc
+#include "vrpn_Shared.h"                // for vrpn_Semaphore, vrpn_Thread
+#include "vrpn_Types.h"                 // for vrpn_int32, vrpn_uint32
+
+class vrpn_MainloopContainer;
+class vrpn_Device_Thread_Connection;
+class VRPN_API vrpn_Poller;
+struct vrpn_Device_Thread_Batch;
+
+class VRPN_API vrpn_Device_Thread {
+
+  public:
+
+    vrpn_Device_Thread (vrpn_Connection * server);
+
+    /// Stops the thread and deletes the devices.  A device that will not
+    /// come out of its mainloop() is left running, with a warning.
+    ~vrpn_Device_Thread (void);
+
+    /// The connection to build the devices on.
+    vrpn_Connection * connection (void);
+
+    /// The devices to run;  add them here before start().
+    vrpn_MainloopContainer * devices (void) { return d_devices; }
+
+    /// Hands whatever the devices have packed so far to the server's
+    /// connection and starts the thread;  with own_thread false,
+    /// mainloop() runs the devices instead.  Returns 0 on success.
+    int start (bool own_thread = true);
+
+    /// Call from the server's loop:  sends on what the devices have packed
+    /// and passes them the messages that have come in for them.
+    void mainloop (void);
+
+    /// What should wake the server for the devices when mainloop() runs
+    /// them;  false if it can't say (see vrpn_Poller.h).
+    bool wake_sources (vrpn_Poller & poller);
+
+    /// The server's connection (lets this be kept in a
+    /// vrpn_MainloopContainer).
+    vrpn_Connection * connectionPtr (void) { return d_server; }
+
+  protected:
+
+    friend class vrpn_Device_Thread_Connection;
+
+    static void threadFunc (vrpn_ThreadData & threadData);
+    static int VRPN_CALLBACK handle_server_message (void * userdata,
+                                                    vrpn_HANDLERPARAM p);
+
+    void run_devices (void);
+      ///< One pass of the thread's loop.
+    void send_to_server (vrpn_Device_Thread_Batch * batch);
+      ///< Packs the batch on the server's connection.
+    int add_sender (vrpn_int32 sender, const char * name);
+    int add_type (vrpn_int32 type, const char * name);
+      ///< Register the name on the server's connection and remember how
+      ///< the IDs go;  add_type() also starts listening for the type.
+
+    vrpn_Connection * d_server;
+    vrpn_Device_Thread_Connection * d_connection;
+    vrpn_MainloopContainer * d_devices;
+
+    // Owned by the thread once it has started.
+    vrpn_Device_Thread_Batch * d_fromDevices;   ///< Filled by d_connection
+    vrpn_Device_Thread_Batch * d_toDevices;     ///< Being delivered
+    vrpn_int32 d_numDeviceSenders;  ///< Known to d_connection so far
+    vrpn_int32 d_numDeviceTypes;
+
+    // Shared, under d_lock.
+    vrpn_Semaphore d_lock;
+    vrpn_Device_Thread_Batch * d_fromDevicesReady;
+    vrpn_Device_Thread_Batch * d_toDevicesReady;
+    bool d_serverConnected;
+    int d_serverPeerVersion;
+    bool d_exit;
+
+    // Owned by the server's thread.
+    vrpn_Device_Thread_Batch * d_fromDevicesSending;
+    vrpn_Device_Thread_Batch * d_toDevicesCollecting;
+    bool d_sending;                 ///< Keeps our own messages from echoing
+    vrpn_int32 d_toServerSender [vrpn_CONNECTION_MAX_SENDERS];
+    vrpn_int32 d_toServerType [vrpn_CONNECTION_MAX_TYPES];
+    vrpn_int32 d_fromServerSender [vrpn_CONNECTION_MAX_SENDERS];
+    vrpn_int32 d_fromServerType [vrpn_CONNECTION_MAX_TYPES];
+
+    bool d_started;
+    vrpn_Semaphore d_done;          ///< v()'d by the thread when it returns
+    vrpn_Thread * d_thread;
+};
+
+/// Lets vrpn_MainloopContainer ask a vrpn_Device_Thread what wakes it.
+inline bool wake_sources_of (vrpn_Device_Thread * t, vrpn_Poller & poller)
+{
+  return t->wake_sources(poller);
+}
+
+#endif  // VRPN_DEVICE_THREAD_H
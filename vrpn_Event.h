@@ -37,8 +37,9 @@ namespace vrpn_Event {
   // fd - handle to the event interface
   void vrpn_close_event( const int fd);
 
-  // read from the interface
-  // returns the number of bytes read successfully
+  // read from the interface, without waiting if there is nothing to read
+  // returns the number of elements read, 0 if none were waiting or -1 if
+  // the read failed
   // fd - handle for the event interface
   // data - handle to the read data
   // max_elements - maximum number of elements to read
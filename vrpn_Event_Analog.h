@@ -37,10 +37,14 @@ public:
 
   ~vrpn_Event_Analog();
 
+  // wake the server when the event interface has something to read
+  virtual bool wake_sources( vrpn_Poller & poller);
+
 protected:
 
-  // read available events
-  // returns number of structs read successfully
+  // read available events, up to max_num_events of them
+  // returns number of structs read successfully, 0 if there were none
+  // waiting or -1 if the read failed
   int read_available_data();
 
 protected:
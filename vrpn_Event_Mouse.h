@@ -53,6 +53,9 @@ private:
 private:
 
   struct timeval timestamp;       
+
+  // skipping the rest of a frame in which the kernel dropped events
+  bool dropped;
 };
 
 #endif // _VRPN_EVENT_MOUSE_H_
@@ -30,6 +30,8 @@
 #include "vrpn_Types.h"                 // for vrpn_float32, vrpn_int32, etc
 
 struct timeval;
+class vrpn_Log_Index;
+class vrpn_Log_Reader;
 
 // Global variable used to indicate whether File Connections should
 // pre-load all of their records into memory when opened.  This is the
@@ -70,6 +72,31 @@ extern VRPN_API bool vrpn_FILE_CONNECTIONS_SHOULD_ACCUMULATE;
 
 extern VRPN_API bool vrpn_FILE_CONNECTIONS_SHOULD_SKIP_TO_USER_MESSAGES;
 
+// Global variable used to indicate whether File Connections should
+// map the log file into memory and play messages straight out of the
+// mapping instead of reading them into buffers.  This defaults to "false".
+// User code should set this to "true" before calling
+// vrpn_get_connection_by_name() or creating a new vrpn_File_Connection
+// object if it wants that file connection to be mapped.  The value is only
+// checked at connection creation time.  A mapped file connection neither
+// preloads nor accumulates (the operating system's page cache does that
+// job, and is shared between programs replaying the same file);  there is
+// no per-message allocation or copying, and jumping around in the file is
+// just a change of offset.  If the file can't be mapped, the connection
+// falls back to reading it as usual.
+
+extern VRPN_API bool vrpn_FILE_CONNECTIONS_SHOULD_MAP;
+
+// Filled in by vrpn_File_Connection::play_as_fast_as_possible().
+struct vrpn_File_Replay_Stats {
+    vrpn_uint32 messages;        // Entries played, system ones included
+    vrpn_uint32 user_messages;
+    timeval file_time;           // From the first user message played
+                                 // to the last
+    vrpn_float64 seconds;        // Wall-clock time it took
+    vrpn_float64 messages_per_second;
+};
+
 class VRPN_API vrpn_File_Connection : public vrpn_Connection
 {
 public:
@@ -116,6 +143,10 @@ public:
     // returns 1 if we're at the end of file
     int eof();
 
+    // sets next_time to the time of the entry that will be played next
+    // returns 0 on success, 1 at the end of the file, -1 on error
+    int next_entry_time(timeval * next_time);
+
     // end_time for play_to_time() is an elapsed time
     // returns -1 on error or EOF, 0 on success
     int play_to_time (vrpn_float64 end_time);
@@ -133,6 +164,17 @@ public:
     // returns 0 on success, 1 if at end_filetime, -1 on error or EOF
     int playone_to_filetime(timeval end_filetime);
 
+    // Batch replay for offline processing:  plays every entry from the
+    // current one to the end of the file through the usual handlers,
+    // as fast as they can take them.  The replay rate and wall clock are
+    // not consulted (and vrpn_gettimeofday() is only called if the
+    // connection is logging).  When reading from the file, a helper
+    // thread reads ahead of playback so the disk is busy while the
+    // handlers run.  If stats is not NULL, it is filled in with how much
+    // was played and how fast.
+    // returns 0 on reaching the end of the file, -1 on error
+    int play_as_fast_as_possible(vrpn_File_Replay_Stats * stats = NULL);
+
     // returns the elapsed time of the file
     timeval get_length();
     double get_length_secs();
@@ -146,6 +188,9 @@ public:
     // returns the name of the file
     const char *get_filename();
 
+    // returns the file's time index, or NULL if it has no up-to-date one
+    const vrpn_Log_Index * get_index (void) const { return d_index; }
+
     // jump_to_time sets the current position to the given elapsed time
 	// return 1 if we got to the specified time and 0 if we didn't
     int jump_to_time(vrpn_float64 newtime);
@@ -155,6 +200,14 @@ public:
     // return 1 if we got to the specified time and 0 if we didn't
     int jump_to_filetime( timeval absolute_time );
 
+    // If the index has a keyframe at or before end_filetime and after the
+    // current entry, plays the records it lists and moves on to the
+    // record after it.  Does nothing if there is no keyframe to use.
+    // play_to_filetime() calls it just after reset();  called before
+    // jump_to_filetime(), it gives the handlers the state at the jump.
+    // returns 0 on success, -1 on error
+    int play_keyframe (timeval end_filetime);
+
     // Not very useful.
     // Limits the number of messages played out on any one call to mainloop.
     // 0 => no limit.
@@ -199,7 +252,7 @@ protected:
 		~vrpn_FileBookmark( );
 		bool valid;
 		timeval oldTime;
-		long int file_pos;  // ftell result
+		vrpn_int64 file_pos;  // file_position() result
 		vrpn_LOGLIST* oldCurrentLogEntryPtr;  // just a pointer, useful for accum or preload
 		vrpn_LOGLIST* oldCurrentLogEntryCopy;  // a deep copy, useful for no-accum, no-preload
 	};
@@ -259,6 +312,7 @@ protected:
 protected:
     char *d_fileName;
     FILE * d_file;
+    vrpn_Log_Reader * d_reader;  // Reads d_file, compressed or not
 
     void play_to_user_message();
 
@@ -280,6 +334,48 @@ protected:
 
     virtual int close_file (void);
 
+    // Time index for the file (see vrpn_LogIndex.h), or NULL if there
+    // is no up-to-date index next to it.  When there is one, the first
+    // and last user-message times come from it instead of a scan of the
+    // file, and jump_to_time() seeks straight to a nearby record when
+    // messages are not being kept in memory.  play_to_time() uses its
+    // keyframes to go backwards without replaying the whole file.
+    vrpn_Log_Index * d_index;
+
+    // Logs and dispatches the current entry without moving past it.
+    // returns 0 on success, -1 on error
+    int play_current_entry (void);
+
+    // Moves the file to the given offset and reads the record there as
+    // the current entry.  Only valid when not accumulating.
+    // returns 0 on success, 1 on EOF, -1 on error
+    int seek_to_file_offset (vrpn_int64 offset);
+
+    // Where the next read_entry() will read from, and moving it.  These
+    // work on the mapping or the reader, whichever we are using;  for a
+    // compressed log they are offsets in the uncompressed stream.
+    vrpn_int64 file_position (void);
+    int set_file_position (vrpn_int64 offset);
+
+    // Memory-mapped playback (see vrpn_FILE_CONNECTIONS_SHOULD_MAP),
+    // for uncompressed logs only.  There is a single list entry, reused for every message, whose
+    // buffer points into the mapping.
+    bool map_file (void);
+    void unmap_file (void);
+    int read_mapped_entry (void);
+      // returns 0 on success, 1 on EOF, -1 on error
+
+    bool d_mapped;             // Reading from a mapping?  Never changes.
+    const char * d_map;        // Start of the mapping, NULL once closed
+    size_t d_mapLength;
+    size_t d_mapPos;           // Offset of the next record to read
+    size_t d_mapEntryPos;      // Offset of the current record
+    char * d_mapScratch;       // For payloads that aren't 8-byte aligned
+    vrpn_int32 d_mapScratchLen;
+#ifdef _WIN32
+    void * d_mapHandle;        // HANDLE from CreateFileMapping()
+#endif
+
     // }}}
     // {{{ handlers for VRPN control messages that might come from
     //     a File Controller object that wants to control this
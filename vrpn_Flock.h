@@ -70,6 +70,7 @@ class VRPN_API vrpn_Tracker_Flock: public vrpn_Tracker_Serial {
   struct timeval tvLastStatusReport;
   int cReports;
   int cStatusInterval;
+  int requestMeasurementRate();
   double getMeasurementRate();
 };
 
@@ -33,6 +33,7 @@
 
 class VRPN_API vrpn_ConnectionForwarder;
 class VRPN_API vrpn_Connection;
+class VRPN_API vrpn_Poller;
 struct vrpn_HANDLERPARAM;
 
 class VRPN_API vrpn_Forwarder_Brain {
@@ -99,6 +100,10 @@ class VRPN_API vrpn_Forwarder_Server : public vrpn_Forwarder_Brain {
 
     virtual void mainloop (void);
 
+    // Tells the poller what should wake the forwarding connections;
+    // false if one of them can't say (see vrpn_Poller.h).
+    virtual bool wake_sources (vrpn_Poller & poller);
+
     virtual void start_remote_forwarding
                  (vrpn_int32 remote_port);
 
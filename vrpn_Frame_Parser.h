@@ -0,0 +1,195 @@
+#ifndef VRPN_FRAME_PARSER_H
+#define VRPN_FRAME_PARSER_H
+
+// vrpn_Frame_Parser
+//
+// Finds the reports ("frames") in the stream of bytes coming from a device.
+// Most serial drivers used to do this with their own state machine in
+// get_report():  read one character at a time until the sync character
+// shows up, then read the rest of a fixed-length report, then check it,
+// flushing the port and starting over if it was bad.  That costs one read
+// per character while syncing, and it throws away whatever good reports
+// were in the port along with a bad one.
+//
+// Here the driver describes its frames with a vrpn_Frame_Format, reads
+// whatever the device has sent into the parser in one go (read_from() for
+// a serial port, or space()/added() or feed() for anything else), and then
+// takes the complete frames out with next() until it returns NULL.  A bad
+// frame costs only the bytes up to the next place a frame could start.
+//
+// Each frame is stamped with the time that its first byte came in:  with
+// a serial reader thread, that of the run of bytes it arrived in (see
+// vrpn_read_available_runs()), and otherwise that of the read.
+//
+// decode() pulls numeric fields out of a frame according to a table of
+// vrpn_Frame_Fields, and unpack_high_bits() undoes the 7-bit packing that
+// Polhemus binary reports use.
+
+#include <stddef.h>                     // for size_t
+
+#include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Shared.h"                // for timeval
+
+const int vrpn_FRAME_MAX_SYNC = 4;
+
+// How a frame ends, once it has been found to start.
+enum vrpn_FRAME_LENGTH {
+    vrpn_FRAME_FIXED,           // Always vrpn_Frame_Format::length bytes
+    vrpn_FRAME_COMPUTED,        // Asked of vrpn_Frame_Format::length_of
+    vrpn_FRAME_TERMINATED       // Ends with vrpn_Frame_Format::terminator
+};
+
+// What checks the last byte of a frame.
+enum vrpn_FRAME_CHECKSUM {
+    vrpn_FRAME_NO_CHECKSUM,
+    vrpn_FRAME_SUM8,            // Low byte of the sum of the bytes before it
+    vrpn_FRAME_XOR8             // XOR of the bytes before it
+};
+
+class VRPN_API vrpn_Frame_Format {
+  public:
+    vrpn_Frame_Format (void);
+
+    /// Every frame starts with sync_len bytes that match sync[] in the
+    /// bits set in sync_mask[] (which is all 1s to begin with).
+    unsigned char sync[vrpn_FRAME_MAX_SYNC];
+    unsigned char sync_mask[vrpn_FRAME_MAX_SYNC];
+    int sync_len;
+
+    vrpn_FRAME_LENGTH length_rule;
+    int length;                 ///< For vrpn_FRAME_FIXED
+    int max_length;             ///< Longest frame there can be (all rules)
+    unsigned char terminator;   ///< For vrpn_FRAME_TERMINATED
+
+    /// For vrpn_FRAME_COMPUTED:  given the first have bytes of a frame,
+    /// returns its length, 0 if it needs to see more bytes to tell, or -1
+    /// if these cannot be the start of a frame.
+    int (*length_of)(const unsigned char *frame, int have, void *userdata);
+
+    /// Bits that are clear in every byte after the sync bytes (for the
+    /// devices that mark the start of a frame with the high bit).
+    unsigned char body_mask;
+
+    /// If >= 0, the value the last byte of every frame has.
+    int trailer;
+
+    vrpn_FRAME_CHECKSUM checksum;
+    int checksum_from;          ///< First byte the checksum covers
+
+    /// If not NULL, called on each complete frame that passed the checks
+    /// above;  returns false if it is not a good frame after all.
+    bool (*validate)(const unsigned char *frame, int len, void *userdata);
+
+    void *userdata;             ///< Passed to length_of and validate
+};
+
+// Types of numeric fields within a frame.
+enum vrpn_FRAME_FIELD_TYPE {
+    vrpn_FRAME_INT8,
+    vrpn_FRAME_UINT8,
+    vrpn_FRAME_INT16,
+    vrpn_FRAME_UINT16,
+    vrpn_FRAME_INT32,
+    vrpn_FRAME_UINT32,
+    vrpn_FRAME_FLOAT32,
+    vrpn_FRAME_FLOAT64
+};
+
+// A field in a frame:  where it is, what it is, and what to multiply it by.
+typedef struct {
+    int offset;
+    vrpn_FRAME_FIELD_TYPE type;
+    bool big_endian;
+    double scale;
+} vrpn_Frame_Field;
+
+class VRPN_API vrpn_Frame_Parser {
+
+  public:
+
+    /// capacity is how many bytes can be waiting to be parsed;  it is made
+    /// at least twice the format's max_length.
+    vrpn_Frame_Parser (const vrpn_Frame_Format &format,
+                       size_t capacity = 4096);
+    ~vrpn_Frame_Parser (void);
+
+    /// Reads everything the serial port has (up to the room there is, and
+    /// to as many runs of bytes as there is room for the times of).
+    /// Returns the number of bytes read, or -1 if the read failed.
+    int read_from (int serial_fd);
+
+    /// Copies bytes in, dropping the oldest ones waiting if there is not
+    /// room for them all.  Returns the number of bytes dropped.
+    size_t feed (const unsigned char *bytes, size_t count,
+                 const struct timeval &when);
+
+    /// Where to put new bytes, and how many will fit there, for reading
+    /// straight into the parser;  then say how many were put there.
+    unsigned char *space (void);
+    size_t room (void) const { return d_capacity - d_end; }
+    void added (size_t count, const struct timeval &when);
+
+    /// The next complete, good frame, or NULL if there is none yet.  It
+    /// stays valid until the next call that puts bytes in.  If when is not
+    /// NULL, it is set to the time of the frame's first byte.
+    const unsigned char *next (int &len, struct timeval *when = NULL);
+
+    /// Bytes skipped looking for frames since the last call, including
+    /// those in frames that failed their checks.
+    size_t discarded (void);
+
+    /// How many bytes are waiting to be parsed.
+    size_t waiting (void) const { return d_end - d_start; }
+
+    /// Throws away everything waiting (as after flushing the port).
+    void clear (void);
+
+    /// Decodes count fields of frame into values[].  Returns 0 on success,
+    /// -1 if one of them lies past the end of the frame.
+    static int decode (const unsigned char *frame, int len,
+                       const vrpn_Frame_Field *fields, int count,
+                       double *values);
+
+    /// Undoes Polhemus 7-bit packing:  each group of up to 8 bytes is 7
+    /// data bytes and then a byte holding their high bits, lowest bit
+    /// first (a short last group has fewer data bytes).  Returns the
+    /// number of bytes written to out, which has room for len.
+    static int unpack_high_bits (const unsigned char *in, int len,
+                                 unsigned char *out);
+
+  protected:
+
+    // When the bytes from one read came in.  Positions count every byte
+    // ever put in, so they do not change when the buffer is compacted.
+    typedef struct {
+        unsigned long position;
+        struct timeval when;
+    } Arrival;
+    enum { MAX_ARRIVALS = 64 };
+
+    bool sync_at (size_t at) const;
+    size_t find_sync (size_t from) const;
+    int frame_length (size_t at, size_t have) const;
+    bool check (const unsigned char *frame, int len) const;
+    void skip (size_t count);
+    void compact (void);
+    void note_arrival (const struct timeval &when);
+    struct timeval arrival_of (unsigned long position);
+
+    vrpn_Frame_Format d_format;
+    unsigned char *d_buffer;
+    size_t d_capacity;
+    size_t d_start;                     ///< First byte not yet parsed
+    size_t d_end;                       ///< One past the last byte put in
+    unsigned long d_base;               ///< Position of d_buffer[0]
+    size_t d_discarded;
+    Arrival d_arrivals[MAX_ARRIVALS];
+    int d_first_arrival;
+    int d_num_arrivals;
+
+  private:
+    vrpn_Frame_Parser (const vrpn_Frame_Parser &);
+    vrpn_Frame_Parser & operator= (const vrpn_Frame_Parser &);
+};
+
+#endif  // VRPN_FRAME_PARSER_H
@@ -34,6 +34,7 @@
 #include <wchar.h>                      // for wcscmp
 
 #include "vrpn_Configure.h"             // for VRPN_API, VRPN_USE_HID, etc
+#include "vrpn_Shared.h"                // for timeval
 #include "vrpn_Types.h"                 // for vrpn_uint16, vrpn_uint8
 
 struct vrpn_HIDDEVINFO {
@@ -63,6 +64,7 @@ public:
 // Forward declarations for hid_device
 struct hid_device_;
 typedef struct hid_device_ hid_device;
+class vrpn_Hid_Queue;
 
 // Main VRPN API for HID devices
 class VRPN_API vrpn_HidInterface {
@@ -75,12 +77,20 @@ public:
 
 	/// Polls the device buffers and causes on_data_received callbacks if appropriate
 	/// You NEED to call this frequently to ensure the OS doesn't drop data
+	/// (unless the reader thread is on, which holds it until then).  If the
+	/// device has gone away, this tries to reconnect once devices have been
+	/// plugged in or removed.
 	virtual void update();
 
 	/// Tries to reconnect to an acceptable device.
 	/// Call this if you suspect a hotplug event has occurred.
 	virtual bool reconnect();
 
+	/// If on, devices opened after this are read by one thread shared by
+	/// all of them, which queues each report with the time it came in
+	/// until update() hands it to on_data_received().
+	static void use_reader_thread(bool on);
+
 	/// Returns USB vendor ID of connected device
 	vrpn_uint16 vendor() const;
 
@@ -104,6 +114,10 @@ protected:
 	*/
 	virtual void on_data_received(size_t bytes, vrpn_uint8 *buffer) = 0;
 
+	/// When the report being handed to on_data_received() came in (when
+	/// it was read, if there is no reader thread).
+	const struct timeval &arrival_time() const { return _arrival; }
+
 	/// Call this to send data to the device
 	void send_data(size_t bytes, const vrpn_uint8 *buffer);
 
@@ -129,8 +143,16 @@ protected:
 	vrpn_uint16 _product;
 	int _interface;
 
+	struct timeval _arrival;
+
 private:
         hid_device  *_device;   ///< The HID device to use.
+	vrpn_Hid_Queue *_queue;	///< Reports the reader thread has read, if it is on
+	unsigned long _hotplug_seen;	///< Hot-plug count when last looked for
+	static bool _use_reader_thread;
+
+	bool reconnect_device();  ///< reconnect(), with hidapi to ourselves
+	void close_device();      ///< Stops reading and closes the device
 };
 
 #endif  // VRPN_USE_HID
@@ -13,6 +13,8 @@
 #include "vrpn_Analog.h"                // for vrpn_Analog
 #include "vrpn_Button.h"                // for vrpn_Button_Filter
 #include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Reset_Steps.h"           // for vrpn_Reset_Steps
+#include "vrpn_Shared.h"                // for timeval
 
 class VRPN_API vrpn_Connection;
 
@@ -24,9 +26,15 @@ public:
 
   void mainloop(void);
 
+  /// Wakes the server when the joystick has events to read.
+  virtual bool wake_sources(vrpn_Poller & poller);
+
 #ifdef VRPN_USE_JOYLIN
 protected:
   int init();
+
+  /// Turns the millisecond time in a joystick event into wall-clock time.
+  void event_time(unsigned int msecs, struct timeval *when);
 #endif
 private:
   int namelen;
@@ -34,6 +42,9 @@ private:
   int version;
   char *devname;
   char *device;
+  vrpn_Reset_Steps reopen;	// When to try opening the device again
+  struct timeval time_offset;	// Wall-clock time of event time 0
+  bool have_time_offset;
 };
 
 
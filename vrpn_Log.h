@@ -1,6 +1,9 @@
 #ifndef VRPN_LOG_H
 #define VRPN_LOG_H
 
+class vrpn_Log_Block_Writer;
+class vrpn_Log_Index;
+
 /**
  * @class vrpn_Log
  * Logs a VRPN stream.
@@ -68,8 +71,69 @@ class VRPN_API vrpn_Log {
     timeval lastLogTime ();
       ///< Returns the time of the last message that was logged
 
+    int setRotation (vrpn_uint32 maxBytes, vrpn_uint32 maxSeconds,
+                     vrpn_uint32 keepFiles = 0);
+      ///< Continuous-capture mode:  start a new log file whenever the
+      ///< current one holds more than maxBytes bytes or spans more than
+      ///< maxSeconds of message time (zero disables either limit).  Each
+      ///< file gets its own cookie and a copy of every sender and type
+      ///< description logged so far, so it can be replayed on its own.
+      ///< Files are named like setCompoundName() does, foo-<n>.bar, after
+      ///< the first one.  If keepFiles is nonzero, only that many of the
+      ///< most recent files are left on disk.  Finished files are written
+      ///< and closed in a helper thread where threads are available.
+
+    int rotate (void);
+      ///< Switches to the next log file now.  Called from logMessage()
+      ///< when one of the limits from setRotation() is exceeded.
+
+    int setIndexing (vrpn_bool on);
+      ///< Builds a time index (see vrpn_LogIndex.h) while the log is
+      ///< written, and saves it next to the log file as <name>.idx when
+      ///< the file is closed.  Each rotated file gets its own index.
+      ///< vrpn_File_Connection uses the index, when there is one, to seek
+      ///< without reading the log from the start.
+
+    int setCompression (vrpn_bool on);
+      ///< Writes the log in blocks that are compressed as they are
+      ///< written (see vrpn_LogCompression.h).  vrpn_File_Connection and
+      ///< the log tools read these files as well as plain ones.  Must be
+      ///< called before anything has been written to the file.  The
+      ///< offsets in the index and the sizes used by setRotation() are
+      ///< those of the uncompressed log.
+
+    int setSyncInterval (vrpn_uint32 msecs);
+      ///< Crash-safe logging:  at most every msecs milliseconds (zero
+      ///< turns it off), logMessage() writes out what is held in memory
+      ///< and has the operating system put it on the disk.  The log is
+      ///< then written in checksummed blocks like setCompression() does
+      ///< (stored as they are unless that is on too), so that after a
+      ///< crash vrpn_File_Connection plays it up to the last good block.
+      ///< A log that goes quiet is synced by syncIfDue(), which the
+      ///< connection calls from its mainloop().  Like setCompression(),
+      ///< must be called before anything has been written to the file.
+
+    int syncIfDue (void);
+      ///< Does the sync that setSyncInterval() asks for if anything has
+      ///< been logged since the last one and the interval has gone by.
+
+    double msecsUntilSync (void);
+      ///< How long until syncIfDue() will have something to do, or -1 if
+      ///< nothing logged is waiting to be synced.
+
   protected:
 
+    void waitForSegmentWriter (void);
+      ///< Blocks until the thread writing the previous file is done.
+
+    int useBlockWriter (const char * caller);
+      ///< Makes or drops the block writer for the open file to match
+      ///< d_compress and d_syncMsecs.
+
+    int keepDescription (const vrpn_LOGLIST * lp);
+      ///< Remembers a copy of a sender or type description so that it
+      ///< can be repeated at the start of every rotated log file.
+
     int checkFilters (vrpn_int32 payloadLen, struct timeval time,
                       vrpn_int32 type, vrpn_int32 sender, const char * buffer);
 
@@ -91,6 +155,35 @@ class VRPN_API vrpn_Log {
     vrpn_TranslationTable * d_types;
 
     timeval d_lastLogTime;
+
+    // Log rotation (continuous capture)
+    vrpn_uint32 d_rotateBytes;
+    vrpn_uint32 d_rotateSeconds;
+    vrpn_uint32 d_rotateKeep;
+    char * d_rotateBaseName;      ///< Name of the first file in the series
+    char ** d_segmentNames;       ///< Ring of the last d_rotateKeep names
+    vrpn_int32 d_segment;         ///< Index of the file being logged to
+    vrpn_uint32 d_segmentBytes;   ///< Bytes logged to the current file
+    timeval d_segmentStart;       ///< Time of its first user message
+    vrpn_bool d_segmentHasUserMessages;
+    vrpn_LOGLIST * d_descriptions;  ///< Singly linked through next
+    vrpn_LOGLIST * d_lastDescription;
+    struct vrpn_LogSegmentWriter * d_segmentWriter;
+
+    // Time index, if setIndexing() was called
+    vrpn_Log_Index * d_index;
+    char * d_indexFileName;       ///< Index name for the open log file
+    vrpn_bool d_indexRescan;      ///< Turned on after part of the file was
+                                  ///< written;  index the file at close()
+
+    // Block compression, if setCompression() was called
+    vrpn_bool d_compress;
+    vrpn_Log_Block_Writer * d_blockWriter;  ///< For the open file
+
+    // Periodic sync, if setSyncInterval() was called
+    vrpn_uint32 d_syncMsecs;
+    timeval d_lastSync;           ///< Wall-clock time of the last one
+    vrpn_bool d_unsynced;         ///< Something was logged since then
 };
 
 
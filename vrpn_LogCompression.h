@@ -0,0 +1,186 @@
+#ifndef VRPN_LOG_COMPRESSION_H
+#define VRPN_LOG_COMPRESSION_H
+
+// Block-compressed VRPN log files.
+//
+// A compressed log holds exactly the same bytes as a plain log (the magic
+// cookie followed by the records), cut into blocks that are each
+// compressed on their own, plus a table that says where each block starts
+// in both the plain byte stream and the file.  Readers see the plain
+// stream through vrpn_Log_Reader, which opens plain logs too, so the
+// offsets in a log index (vrpn_LogIndex.h) mean the same thing for both
+// kinds of file and anything written against the reader handles both.
+//
+// Each block only holds whole records (a record bigger than the block
+// size gets a block to itself;  records are limited to 16 MB, so that a
+// reader can tell a torn block header from a real one).  Before compression, every record header
+// is XORed with the one before it, and every payload with the previous
+// payload of the same length from the same sender and type in that block;
+// for trackers and analogs, whose values change little from report to
+// report, this turns most bytes into zeros.  The zeros are then squeezed
+// out eight bytes at a time and the result is run through a small LZ77
+// coder.  A block that doesn't get smaller is stored as is.
+//
+// File layout;  all values are 32-bit integers in network order:
+//   16-byte magic ("vrpn: blocks 1.0"), block size, cookie length, cookie
+//   blocks:  "vBLK", plain length, stored length, flags, Adler-32 of the
+//            plain bytes, then the stored bytes
+//   table:   "vTBL", block count, then per block the plain offset
+//            (high, low) and file offset (high, low)
+//   trailer: table file offset (high, low), plain length (high, low),
+//            16-byte end magic ("vrpn: blocks end")
+// A file that was not finished (the writer died) has no table;  the
+// reader rebuilds it by walking the block headers and stops at the last
+// complete block whose checksum is good.  Since blocks only hold whole
+// records and are only ever appended, that is a valid log, and with
+// vrpn_Log_Block_Writer::sync() called now and then it holds everything
+// up to the last sync.
+
+#include <stdio.h>                      // for FILE, size_t
+
+#include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Types.h"                 // for vrpn_int32, vrpn_uint32
+
+/// Collects the bytes of a log into blocks and writes them compressed.
+class VRPN_API vrpn_Log_Block_Writer {
+
+  public:
+
+    /// Writes to file, which the caller still owns and must close after
+    /// finish().
+    vrpn_Log_Block_Writer (FILE * file,
+                           vrpn_uint32 blockSize = DEFAULT_BLOCK_SIZE);
+    ~vrpn_Log_Block_Writer (void);
+
+    static const vrpn_uint32 DEFAULT_BLOCK_SIZE = 65536;
+
+    /// Writes the file header.  Must come first.
+    int write_cookie (const char * cookie, vrpn_int32 cookieLen);
+
+    /// Adds one record;  header is the six 32-bit values as they are
+    /// stored in a plain log (network order).
+    int add_record (const vrpn_int32 header [6], const char * payload,
+                    vrpn_int32 payloadLen);
+
+    /// Compresses and writes whatever is waiting, as a short block.
+    int flush (void);
+
+    /// Flushes, then has the operating system put everything written so
+    /// far on the disk (fdatasync() or the nearest thing to it).  Once
+    /// this has been called, finish() syncs the block table as well.
+    int sync (void);
+
+    /// With compression off, blocks are stored as they are, which still
+    /// gives each one a checksum.  It is on unless this is called.
+    void set_compression (bool on) { d_compress = on; }
+
+    /// Flushes and writes the block table.  Nothing may be added after.
+    int finish (void);
+
+  protected:
+
+    int write_block (void);
+    int write_int32s (const vrpn_int32 * values, int count);
+
+    FILE * d_file;
+    vrpn_uint32 d_blockSize;
+    bool d_compress;
+    bool d_syncing;               ///< sync() has been called
+    vrpn_int64 d_filePos;         ///< Where the next block goes
+    vrpn_int64 d_plainPos;        ///< Plain offset of the waiting bytes
+    bool d_failed;
+
+    char * d_block;               ///< Plain bytes waiting to be written
+    vrpn_uint32 d_blockLen;
+    vrpn_uint32 d_blockMax;
+    char * d_work1;               ///< Scratch for the compression stages
+    char * d_work2;
+    vrpn_uint32 d_workMax;
+
+    struct TableEntry {
+      vrpn_int64 plain;
+      vrpn_int64 file;
+    };
+    TableEntry * d_table;
+    vrpn_uint32 d_numBlocks;
+    vrpn_uint32 d_maxBlocks;
+};
+
+/// Reads a plain or block-compressed log as the plain byte stream, with
+/// the same sort of read/seek/tell calls as stdio.
+class VRPN_API vrpn_Log_Reader {
+
+  public:
+
+    vrpn_Log_Reader (void);
+    ~vrpn_Log_Reader (void);
+
+    /// Opens the named file.  Returns 0 on success.
+    int open (const char * fileName);
+
+    /// Reads from a file that the caller opened in binary mode and will
+    /// close after close() (or after this object is gone).  Returns 0 on
+    /// success.
+    int attach (FILE * file);
+
+    void close (void);
+
+    bool is_compressed (void) const { return d_compressed; }
+
+    /// The FILE underneath a plain log (NULL for a compressed one), for
+    /// callers that want to map it.
+    FILE * raw_file (void) const { return d_compressed ? NULL : d_file; }
+
+    /// Returns how many bytes were read;  fewer than asked for at the end
+    /// of the log or on error.
+    size_t read (void * buffer, size_t len);
+
+    /// Moves to a plain offset.  Returns 0 on success.
+    int seek (vrpn_int64 offset);
+    vrpn_int64 tell (void) const;
+
+    /// Length of the plain stream.  For a compressed log that was not
+    /// finished, this is the end of the last complete block.
+    vrpn_int64 size (void) const { return d_size; }
+
+    /// True if a compressed log had no table and was read up to its
+    /// last complete block.
+    bool was_truncated (void) const { return d_truncated; }
+
+  protected:
+
+    int read_table (vrpn_int64 fileSize);
+    int scan_blocks (vrpn_int64 fileSize);
+    int load_block (vrpn_uint32 which);
+    vrpn_uint32 find_block (vrpn_int64 offset) const;
+    bool add_table_entry (vrpn_int64 plain, vrpn_int64 file);
+
+    FILE * d_file;
+    bool d_ownFile;
+    bool d_compressed;
+    bool d_truncated;
+    vrpn_int64 d_size;
+    vrpn_int64 d_pos;             ///< Plain offset of the next read
+
+    char * d_cookie;              ///< Plain bytes before the first block
+    vrpn_int32 d_cookieLen;
+
+    struct TableEntry {
+      vrpn_int64 plain;
+      vrpn_int64 file;
+    };
+    TableEntry * d_table;
+    vrpn_uint32 d_numBlocks;
+    vrpn_uint32 d_maxBlocks;
+
+    vrpn_uint32 d_current;        ///< Block in d_plain, or d_numBlocks
+    char * d_plain;
+    vrpn_uint32 d_plainLen;
+    vrpn_uint32 d_plainMax;
+    char * d_stored;
+    char * d_work;
+    vrpn_uint32 d_storedMax;
+    vrpn_uint32 d_maxPlainLen;    ///< Most a block can hold, from the header
+};
+
+#endif  // VRPN_LOG_COMPRESSION_H
@@ -0,0 +1,205 @@
+#ifndef VRPN_LOG_INDEX_H
+#define VRPN_LOG_INDEX_H
+
+// vrpn_Log_Index
+//
+// A time index for a VRPN log file, kept in a sidecar file next to the
+// log (foo.vrpn -> foo.vrpn.idx).  It lets vrpn_File_Connection find the
+// first and last user-message times and the length of a log without
+// reading the whole file, and seek to a time by looking up a nearby file
+// offset instead of replaying from the start.  It also records how many
+// messages of each (sender, type) pair the log holds and over what time
+// span, along with the sender and type names from the log's description
+// messages.
+//
+// Every KEYFRAME_INTERVAL seek points, the index also keeps a keyframe:
+// the offsets of the latest record of each (sender, type) pair before
+// that seek point, plus any sender or type descriptions that came after
+// the first user message.  Playing those records and then the ones from
+// the seek point on gives handlers the state they would have had after
+// playing the whole log up to there, as far as that state is "the last
+// message of each kind".  vrpn_File_Connection::play_to_time() uses
+// this when asked to go backwards.
+//
+// The index is built either by vrpn_Log while it writes the file (see
+// vrpn_Log::setIndexing()) or afterwards from an existing log with
+// build_from_log() (the logfileindex program does this).  An index whose
+// recorded log size does not match the log on disk is considered stale
+// and is ignored, so readers fall back to scanning the log.
+//
+// Index file layout;  all values are 32-bit integers in network order:
+//   16-byte magic cookie ("vrpn: index 01.1";  01.0 files, which have
+//            no keyframes, are read too)
+//   header:  log size (high, low), offset of the first user message
+//            (high, low;  -1 if none), record count, seek-point count,
+//            count-entry count, name count, earliest user time (sec,
+//            usec), highest user time (sec, usec), 1 if there are user
+//            messages
+//   seek points:  file offset (high, low), record number, latest time
+//            of any record from the first user message up to this one
+//            (sec, usec)
+//   counts:  sender, type, count, first time (sec, usec), last time
+//            (sec, usec)
+//   names:   kind (vrpn_CONNECTION_SENDER_DESCRIPTION or
+//            vrpn_CONNECTION_TYPE_DESCRIPTION), id, length, then the
+//            name padded with NULs to a multiple of four bytes
+//   keyframe header:  keyframe count, keyframe record count
+//   keyframes:  seek-point number, number of records
+//   keyframe records:  file offset (high, low) of each record of each
+//            keyframe in turn, in file order within a keyframe
+
+#include <stdio.h>                      // for FILE
+
+#include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Connection.h"            // for cName
+#include "vrpn_Shared.h"                // for timeval
+#include "vrpn_Types.h"                 // for vrpn_int32, vrpn_uint32
+
+/// Per-(sender, type) statistics stored in a log index.  The IDs are the
+/// ones used in the log file, not local IDs.
+struct vrpn_Log_Index_Count {
+  vrpn_int32 sender;
+  vrpn_int32 type;
+  vrpn_uint32 count;
+  timeval first_time;
+  timeval last_time;
+};
+
+class VRPN_API vrpn_Log_Index {
+
+  public:
+
+    vrpn_Log_Index (void);
+    ~vrpn_Log_Index (void);
+
+    /// Record one out of this many gets a seek point.
+    static const vrpn_uint32 RECORDS_PER_SEEK_POINT = 256;
+
+    /// One seek point out of this many gets a keyframe.
+    static const vrpn_uint32 KEYFRAME_INTERVAL = 16;
+
+    /// Returns a new string holding the name of the index file for the
+    /// given log file.  The caller must delete [] it.
+    static char * index_name_for (const char * log_file_name);
+
+    // BUILDING
+
+    /// Forgets everything and gets ready to index a new log whose first
+    /// record will be found at first_offset (just past the cookie).
+    void clear (vrpn_int64 first_offset = 0);
+
+    /// Adds the next record in the file.  The payload is only looked at
+    /// for sender and type descriptions, to pick up the names;  it may be
+    /// NULL for other messages.  Records must be added in file order.
+    int add_record (vrpn_int32 type, vrpn_int32 sender, timeval time,
+                    vrpn_int32 payload_len, const char * payload);
+
+    /// Scans an existing log file and indexes it.  Returns 0 on success.
+    int build_from_log (const char * log_file_name);
+
+    /// Writes the index.  Call it after the last record of the log has
+    /// been added, so that the recorded log size is the final one.
+    int write (const char * index_file_name) const;
+
+    // READING
+
+    /// Reads an index file.  If log_size is not negative, the index is
+    /// rejected unless it was made from a log of exactly that size.
+    /// Returns 0 on success, -1 on failure or stale index.
+    int read (const char * index_file_name, vrpn_int64 log_size = -1);
+
+    /// Finds where a forward search for the first record whose time is
+    /// later than t can start:  every record from the first user message
+    /// up to the returned offset has a time no later than t.  The system
+    /// messages at the head of the file (sender and type descriptions)
+    /// are not included, since vrpn_File_Connection plays them before it
+    /// starts searching.  Returns false if there is no such seek point.
+    bool find_seek_point (timeval t, vrpn_int64 & offset,
+                          vrpn_uint32 & record) const;
+
+    /// Finds the latest keyframe at or before the seek point that
+    /// find_seek_point() would return for t.  offset is where playing
+    /// should carry on after the keyframe's records, which are returned
+    /// as an array of num_records file offsets owned by the index.
+    /// Returns false if there is no such keyframe.
+    bool find_keyframe (timeval t, vrpn_int64 & offset,
+                        const vrpn_int64 * & records,
+                        vrpn_uint32 & num_records) const;
+    vrpn_uint32 num_keyframes (void) const { return d_numKeyframes; }
+
+    bool has_user_messages (void) const { return d_hasUserMessages; }
+    timeval earliest_user_time (void) const { return d_earliestUser; }
+    timeval highest_user_time (void) const { return d_highestUser; }
+    vrpn_int64 log_size (void) const { return d_nextOffset; }
+    vrpn_int64 first_user_offset (void) const { return d_firstUserOffset; }
+    vrpn_uint32 num_records (void) const { return d_numRecords; }
+
+    vrpn_uint32 num_counts (void) const { return d_numCounts; }
+    const vrpn_Log_Index_Count & count (vrpn_uint32 i) const
+      { return d_counts[i]; }
+
+    /// Returns the name described for a sender or type ID in the log,
+    /// or NULL if the log did not describe it.
+    const char * sender_name (vrpn_int32 id) const;
+    const char * type_name (vrpn_int32 id) const;
+
+  protected:
+
+    struct SeekPoint {
+      vrpn_int64 offset;
+      vrpn_uint32 record;
+      timeval max_time_before;
+    };
+    struct Name {
+      vrpn_int32 kind;
+      vrpn_int32 id;
+      cName name;
+    };
+    struct Keyframe {
+      vrpn_uint32 seek;           ///< Index into d_seek
+      vrpn_uint32 first;          ///< Index into d_keyRecords
+      vrpn_uint32 count;
+    };
+
+    const char * find_name (vrpn_int32 kind, vrpn_int32 id) const;
+    vrpn_Log_Index_Count * find_count (vrpn_int32 sender, vrpn_int32 type);
+    int add_keyframe (void);
+    void free_tables (void);
+
+    vrpn_int64 d_nextOffset;      ///< Offset of the next record to add
+    vrpn_uint32 d_numRecords;
+    timeval d_maxTime;            ///< Latest time since the first user msg
+    vrpn_int64 d_firstUserOffset; ///< -1 until there is a user message
+
+    vrpn_bool d_hasUserMessages;
+    timeval d_earliestUser;
+    timeval d_highestUser;
+
+    SeekPoint * d_seek;
+    vrpn_uint32 d_numSeek;
+    vrpn_uint32 d_maxSeek;
+
+    vrpn_Log_Index_Count * d_counts;
+    vrpn_uint32 d_numCounts;
+    vrpn_uint32 d_maxCounts;
+    vrpn_uint32 d_lastCount;      ///< Cache for find_count()
+    vrpn_int64 * d_lastOffsets;   ///< Latest record for each count entry;
+    vrpn_uint32 d_maxLastOffsets; ///< only kept while building
+
+    Name * d_names;
+    vrpn_uint32 d_numNames;
+    vrpn_uint32 d_maxNames;
+
+    vrpn_int64 * d_lateDescriptions; ///< Descriptions after the first user
+    vrpn_uint32 d_numLateDescriptions;   ///< message (building only)
+    vrpn_uint32 d_maxLateDescriptions;
+
+    Keyframe * d_keyframes;
+    vrpn_uint32 d_numKeyframes;
+    vrpn_uint32 d_maxKeyframes;
+    vrpn_int64 * d_keyRecords;
+    vrpn_uint32 d_numKeyRecords;
+    vrpn_uint32 d_maxKeyRecords;
+};
+
+#endif  // VRPN_LOG_INDEX_H
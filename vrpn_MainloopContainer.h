@@ -62,6 +62,23 @@ class vrpn_MainloopContainer {
 		/// that they were added.
 		void mainloop();
 
+		/// Tells the poller what should wake each contained object.
+		/// Returns false if any of them can't say (see vrpn_Poller.h).
+		bool wake_sources(vrpn_Poller & poller);
+
+		/// Whether any objects have been added.
+		bool empty() const { return _vrpn.empty(); }
+
+		/// How many objects there are, and each in the order added.
+		/// @{
+		size_t size() const { return _vrpn.size(); }
+		vrpn_MainloopObject * at(size_t i) const { return _vrpn[i]; }
+		/// @}
+
+		/// Remove one object and delete it.  Returns false if it is
+		/// not in the container.
+		bool remove(vrpn_MainloopObject * o);
+
 	private:
 		std::vector<vrpn_MainloopObject *> _vrpn;
 };
@@ -102,6 +119,17 @@ inline void vrpn_MainloopContainer::clear() {
 	_vrpn.clear();
 }
 
+inline bool vrpn_MainloopContainer::remove(vrpn_MainloopObject * o) {
+	for (size_t i = 0; i < _vrpn.size(); ++i) {
+		if (_vrpn[i] == o) {
+			_vrpn.erase(_vrpn.begin() + i);
+			delete o;
+			return true;
+		}
+	}
+	return false;
+}
+
 inline void vrpn_MainloopContainer::mainloop() {
 	const size_t n = _vrpn.size();
 	for (size_t i = 0; i < n; ++i) {
@@ -109,3 +137,13 @@ inline void vrpn_MainloopContainer::mainloop() {
 	}
 }
 
+inline bool vrpn_MainloopContainer::wake_sources(vrpn_Poller & poller) {
+	bool all = true;
+	const size_t n = _vrpn.size();
+	for (size_t i = 0; i < n; ++i) {
+		if (!_vrpn[i]->wake_sources(poller)) {
+			all = false;
+		}
+	}
+	return all;
+}
@@ -22,6 +22,7 @@
 
 // Internal Includes
 #include "vrpn_Connection.h"
+#include "vrpn_BaseClass.h"
 
 // Library/third-party includes
 // - none
@@ -57,6 +58,10 @@ class vrpn_MainloopObject {
 		/// NULL.
 		virtual bool broken() = 0;
 
+		/// Tells the poller what should wake the object; false if it
+		/// can't say (see vrpn_Poller.h).
+		virtual bool wake_sources(vrpn_Poller & poller) = 0;
+
 		/// Templated wrapping function
 		template<class T>
 		static vrpn_MainloopObject * wrap(T o);
@@ -89,6 +94,17 @@ inline bool operator!=(vrpn_MainloopObject const & lhs, vrpn_MainloopObject cons
 
 /// Namespace enclosing internal implementation details
 namespace detail {
+	/// VRPN devices can say what wakes them; other objects can't, unless
+	/// their header gives a wake_sources_of() overload for them.
+	/// @{
+	inline bool wake_sources_of(vrpn_BaseClassUnique * o, vrpn_Poller & poller) {
+		return o->wake_sources(poller);
+	}
+	inline bool wake_sources_of(const void *, vrpn_Poller &) {
+		return false;
+	}
+	/// @}
+
 	template<class T>
 	class TypedMainloopObject;
 
@@ -122,6 +138,10 @@ namespace detail {
 				return (_instance->connectionPtr() == NULL);
 			}
 
+			virtual bool wake_sources(vrpn_Poller & poller) {
+				return wake_sources_of(_instance, poller);
+			}
+
 		protected:
 			virtual void * _returnContained() const {
 				return _instance;
@@ -154,6 +174,10 @@ namespace detail {
 				return (!_instance->doing_okay());
 			}
 
+			virtual bool wake_sources(vrpn_Poller & poller) {
+				return _instance->wake_sources(poller);
+			}
+
 		protected:
 			virtual void * _returnContained() const {
 				return _instance;
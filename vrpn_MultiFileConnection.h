@@ -0,0 +1,177 @@
+#ifndef VRPN_MULTI_FILE_CONNECTION_H
+#define VRPN_MULTI_FILE_CONNECTION_H
+
+// vrpn_Multi_File_Connection
+//
+// Plays several log files back together, as if they had been logged by
+// one server:  the messages from all of the files are merged in time
+// order on a single clock.  This is for setups where each group of
+// devices has its own vrpn_server writing its own log, and the logs have
+// to be looked at together.
+//
+// Each file is read by a vrpn_File_Connection of its own (so preloading,
+// mapping, compressed logs and indices all work as usual), and a heap
+// keyed on the time of each file's next message picks which file to play
+// from next.  The user messages are handed on to the handlers registered
+// on this connection, so remotes are simply created on it:
+//
+//   vrpn_Connection * c =
+//       vrpn_get_connection_by_name("file:head.vrpn|file:hands.vrpn");
+//   vrpn_Tracker_Remote t ("Tracker0", c);
+//
+// Senders with the same name in more than one file are told apart by
+// putting the file's name (without directory or extension) in front:  a
+// "Tracker0" found in both head.vrpn and hands.vrpn becomes
+// "head/Tracker0" and "hands/Tracker0".  Senders that appear in only one
+// file keep their names, unless the connection was asked to prefix them
+// all.  Which names are shared is worked out when the files are opened,
+// from every sender each file describes (its index has the list;  files
+// without one are scanned).  Message types are shared by name.
+//
+// Playback is controlled the same way as for a vrpn_File_Connection, by
+// calling the methods below or through a vrpn_File_Controller.  Going
+// backwards resets every file and plays forwards from the start, in
+// merged order.  get_File_Connection() returns NULL for this connection,
+// since there is no single file behind it.
+
+#include "vrpn_Configure.h"             // for VRPN_API, VRPN_CALLBACK
+#include "vrpn_Connection.h"            // for vrpn_Connection, etc
+#include "vrpn_Shared.h"                // for timeval
+#include "vrpn_Types.h"                 // for vrpn_int32, vrpn_float32, etc
+
+class VRPN_API vrpn_File_Connection;
+
+class VRPN_API vrpn_Multi_File_Connection : public vrpn_Connection
+{
+  public:
+
+    /// Opens the files named in station_name, which are file: names
+    /// separated by '|' characters.
+    vrpn_Multi_File_Connection (const char * station_name,
+                                bool prefix_all_senders = false);
+
+    /// Opens each of num_files file: names.
+    vrpn_Multi_File_Connection (const char * const * file_names,
+                                int num_files,
+                                bool prefix_all_senders = false);
+
+    virtual ~vrpn_Multi_File_Connection (void);
+
+    /// Plays whatever is due at the current replay rate.
+    virtual int mainloop (const timeval * timeout = NULL);
+
+    /// Elapsed time since the earliest user message in any of the files.
+    virtual int time_since_connection_open (timeval * elapsed_time);
+    virtual timeval get_time (void) { return d_time; }
+
+    /// Nothing is sent anywhere;  just clears the buffer.
+    virtual int send_pending_reports (void);
+
+    // PLAYBACK CONTROL, as for vrpn_File_Connection
+
+    /// 0.0 is paused, 1.0 is normal speed.
+    void set_replay_rate (vrpn_float32 rate);
+    vrpn_float32 get_replay_rate (void) const { return d_replay_rate; }
+
+    /// Goes back to the start of every file.  Returns 0 on success.
+    int reset (void);
+
+    /// Returns 1 once every file has been played to its end.
+    int eof (void);
+
+    /// end_time is elapsed from the earliest user message;
+    /// end_filetime is an absolute time as stamped in the files.
+    /// Plays every message up to that time, in time order across all of
+    /// the files.  Returns 0 on success, -1 on error.
+    int play_to_time (vrpn_float64 end_time);
+    int play_to_time (timeval end_time);
+    int play_to_filetime (const timeval end_filetime);
+
+    /// Moves every file to the given time without playing the messages
+    /// in between, other than those of the latest keyframe of each
+    /// file's index (see vrpn_LogIndex.h).  Returns 1 if some file has
+    /// messages after that time, 0 if they have all run out.
+    int jump_to_time (vrpn_float64 newtime);
+    int jump_to_time (timeval newtime);
+    int jump_to_filetime (timeval absolute_time);
+
+    /// Span of the user messages across all of the files.
+    timeval get_length (void);
+    double get_length_secs (void);
+    timeval get_lowest_user_timestamp (void) { return d_earliest; }
+    timeval get_highest_user_timestamp (void) { return d_highest; }
+
+    int num_files (void) const { return d_numFiles; }
+    vrpn_File_Connection * file_connection (int which);
+
+    /// Name put in front of the senders from the given file when they
+    /// need telling apart.
+    const char * file_label (int which) const;
+
+  protected:
+
+    /// One of the files being merged.  The ID maps turn the IDs used
+    /// on its vrpn_File_Connection into IDs on this connection;  -2
+    /// means not looked up yet and -1 means not passed on.
+    struct Source {
+      vrpn_Multi_File_Connection * parent;
+      vrpn_File_Connection * connection;
+      int which;
+      char * label;
+      timeval next_time;          ///< Time of its next message
+      vrpn_int32 * senders;
+      vrpn_int32 * types;
+    };
+
+    void open_files (const char * const * file_names, int num_files);
+    bool source_less (const Source * a, const Source * b) const;
+    void sift_up (int i);
+    void sift_down (int i);
+    int build_heap (void);
+    int play_next (void);
+
+    vrpn_int32 map_sender (Source * s, vrpn_int32 id);
+    vrpn_int32 map_type (Source * s, vrpn_int32 id);
+    bool is_builtin_sender (const char * name);
+    int find_shared_senders (void);
+    bool is_shared_sender (const char * name) const;
+
+    static int VRPN_CALLBACK handle_file_message (void * userdata,
+                                                  vrpn_HANDLERPARAM p);
+
+    // Messages from a vrpn_File_Controller
+    static int VRPN_CALLBACK handle_set_replay_rate (void * userdata,
+                                                     vrpn_HANDLERPARAM p);
+    static int VRPN_CALLBACK handle_reset (void * userdata,
+                                           vrpn_HANDLERPARAM p);
+    static int VRPN_CALLBACK handle_play_to_time (void * userdata,
+                                                  vrpn_HANDLERPARAM p);
+
+    vrpn_int32 d_controllerId;
+    vrpn_int32 d_set_replay_rate_type;
+    vrpn_int32 d_reset_type;
+    vrpn_int32 d_play_to_time_type;
+    vrpn_int32 d_numBuiltinSenders;  ///< Registered before any file was read
+
+    Source * d_files;
+    int d_numFiles;
+    Source ** d_heap;             ///< Files with messages left, soonest first
+    int d_heapSize;
+    bool d_prefixAll;
+    cName * d_sharedSenders;      ///< Names more than one file has
+    int d_numSharedSenders;
+    bool d_forwarding;            ///< Off while the files are being moved
+
+    timeval d_time;               ///< Current time in the files
+    timeval d_earliest;           ///< Earliest user message in any file
+    timeval d_highest;            ///< Latest user message in any file
+
+    // Replay clock, as in vrpn_File_Connection:  file time that is due
+    // but not yet played, and the wall-clock time it was worked out at.
+    vrpn_float32 d_replay_rate;
+    timeval d_accumulated;
+    timeval d_last_accumulate;
+    void accumulate_to (const timeval & now);
+};
+
+#endif  // VRPN_MULTI_FILE_CONNECTION_H
@@ -0,0 +1,69 @@
+#ifndef VRPN_POLLER_H
+#define VRPN_POLLER_H
+
+// vrpn_Poller
+//
+// Lets a server sleep until there is something for it to do, rather than
+// spinning over its devices and connection and sleeping a fixed time in
+// between.  Each time around the loop, the devices and the connection
+// tell the poller what should wake them (wake_sources()):  the file
+// descriptors and sockets they read from (serial ports, /dev/input,
+// UDP sockets, client connections) and the time their next timed report
+// is due.  wait() then sleeps in a single poll() (select() on Windows)
+// until one of those descriptors can be read or the earliest time has
+// come.
+//
+// The sources are given again on every pass and forgotten after each
+// wait(), so a driver that closes and reopens its port needs nothing
+// special.  An object that cannot say what should wake it returns false
+// from wake_sources();  the caller then bounds the wait with a timeout,
+// which is how the server keeps polling such devices at the old rate.
+
+#include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Shared.h"                // for SOCKET, timeval
+
+class VRPN_API vrpn_Poller {
+
+  public:
+
+    vrpn_Poller (void);
+    ~vrpn_Poller (void);
+
+    /// Wake when there is something to read on this descriptor or socket.
+    void add_fd (SOCKET fd);
+
+    /// Wake no later than this time (as given by vrpn_gettimeofday()).
+    void add_deadline (const struct timeval & when);
+
+    /// Wake no later than this many milliseconds from now.
+    void add_timeout (double msecs);
+
+    /// Sleep until one of the descriptors can be read or the earliest
+    /// deadline has come, but no longer than max_wait (NULL for no limit).
+    /// Returns the number of descriptors that can be read, 0 on timeout,
+    /// -1 on error.  The sources are forgotten afterwards.
+    int wait (const struct timeval * max_wait = NULL);
+
+    /// Forgets the sources without waiting.
+    void clear (void);
+
+    /// How many descriptors wait() would watch.
+    int num_fds (void) const { return d_numFds; }
+
+  protected:
+
+    SOCKET * d_fds;
+    int d_numFds;
+    int d_maxFds;
+    void * d_pollfds;                   ///< struct pollfd [d_maxFds]
+
+    bool d_haveDeadline;
+    struct timeval d_deadline;          ///< Earliest deadline this pass
+
+  private:
+
+    vrpn_Poller (const vrpn_Poller &);
+    vrpn_Poller & operator = (const vrpn_Poller &);
+};
+
+#endif  // VRPN_POLLER_H
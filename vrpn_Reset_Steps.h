@@ -0,0 +1,67 @@
+#ifndef VRPN_RESET_STEPS_H
+#define VRPN_RESET_STEPS_H
+
+// vrpn_Reset_Steps
+//
+// Lets a driver reset or reopen its device without sleeping inside
+// mainloop().  Resetting a serial tracker means sending it a command,
+// waiting a second or two (up to 20 for a ^Y reset) for it to respond,
+// sending the next one, and so on.  Doing those waits with
+// vrpn_SleepMsecs() froze every other device in the server, and all of
+// the client traffic, for as long as the reset took.
+//
+// Instead, the driver writes its reset() as a switch on step(), with one
+// case for each piece of work between two waits.  A case that needs to
+// wait calls next(msecs) (or go_to() or again()) and returns;  mainloop()
+// calls reset() again only once ready() says that the time has come,
+// and the server's poller is told to wake at due().  A case that does
+// not need to wait can fall through into the next one.  restart() starts
+// over at step 0, which is what a driver does when it goes back to
+// vrpn_TRACKER_FAIL or has to retry.
+//
+// vrpn_Tracker_Serial, vrpn_Serial_Analog and vrpn_Button_Serial each
+// have one of these named reset_steps.
+
+#include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Shared.h"                // for timeval
+
+class VRPN_API vrpn_Reset_Steps {
+
+  public:
+
+    vrpn_Reset_Steps (void);
+
+    /// Go back to step 0, to be run right away.
+    void restart (void);
+
+    /// Which step is to be run next.
+    int step (void) const { return d_step; }
+
+    /// Move on to the next step, to be run msecs from now.
+    void next (double msecs = 0);
+
+    /// Move to the given step, to be run msecs from now.
+    void go_to (int step, double msecs = 0);
+
+    /// Run this step again msecs from now (to poll for a response).
+    void again (double msecs);
+
+    /// Has the time come to run the next step?
+    bool ready (void) const;
+
+    /// When the next step is to be run (for vrpn_Poller::add_deadline()).
+    const struct timeval & due (void) const { return d_due; }
+
+    /// How long it has been since the current step was entered, in
+    /// milliseconds (again() does not count as entering it).  Used by
+    /// steps that poll for a response to decide when to give up.
+    double msecs_in_step (void) const;
+
+  protected:
+
+    int d_step;
+    struct timeval d_due;               ///< Don't run d_step before this
+    struct timeval d_entered;           ///< When d_step was entered
+};
+
+#endif  // VRPN_RESET_STEPS_H
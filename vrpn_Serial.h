@@ -2,6 +2,7 @@
 #define VRPN_SERIAL_H
 
 #include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Shared.h"                // for timeval
 #include <stddef.h>	// For size_t
 
 /// @file
@@ -69,4 +70,58 @@ extern VRPN_API int vrpn_read_available_characters(int comm, unsigned char *buff
 
 extern VRPN_API int vrpn_write_characters(int comm, const unsigned char *buffer, size_t bytes);
 
+/// @name Reader thread
+///
+/// A port can have its own thread that reads characters as soon as they
+/// arrive, noting when each batch came in, and keeps them until they are
+/// asked for.  The read routines above then take characters from there
+/// rather than from the port, and vrpn_serial_arrival_time() tells when
+/// the last of the characters they returned came in.  A driver that does
+/// this for the first character of a report gets its time of arrival
+/// rather than the time the server got around to parsing it.
+///
+/// The thread is stopped by vrpn_close_commport().  It is not available on
+/// Windows, where vrpn_start_serial_reader() fails and the port is read
+/// directly as before.
+/// @{
+
+/// @brief Start reading the port in a thread of its own.
+/// @returns 0 on success (or if it is already being read that way), -1 on
+/// failure.
+extern VRPN_API int vrpn_start_serial_reader(int comm);
+
+/// @brief Is the port being read by a thread of its own?
+extern VRPN_API bool vrpn_serial_reader_running(int comm);
+
+/// @brief When the last character returned by a read routine arrived.
+///
+/// Without a reader thread, this is the current time.
+/// @returns 0 on success, -1 on error.
+extern VRPN_API int vrpn_serial_arrival_time(int comm, struct timeval *when);
+
+/// @brief A run of characters that came in at the same time.
+typedef struct {
+  size_t count;
+  struct timeval arrived;
+} vrpn_Serial_Run;
+
+/// @brief Reads like vrpn_read_available_characters(), and also tells when
+/// each run of the characters read came in.
+///
+/// runs[] gets the length and arrival time of each run, in order, and
+/// num_runs how many there were.  No more than max_runs runs are read;  the
+/// characters after them are left for the next read.  Without a reader
+/// thread, everything read is one run that arrived now.
+/// @returns The number of characters read, or -1 on error.
+extern VRPN_API int vrpn_read_available_runs(int comm, unsigned char *buffer,
+		size_t count, vrpn_Serial_Run *runs, int max_runs, int *num_runs);
+
+/// @brief What to wait on (select(), vrpn_Poller) for characters to read.
+///
+/// This is the port itself unless it has a reader thread, in which case
+/// it is a descriptor that the thread makes readable when it has
+/// characters waiting to be read.
+extern VRPN_API int vrpn_serial_wake_fd(int comm);
+/// @}
+
 #endif
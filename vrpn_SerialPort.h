@@ -110,6 +110,22 @@ class VRPN_API vrpn_SerialPort {
 		void assign_rts(bool set);
 		/// @}
 
+		/// @name Reader thread
+		/// @sa vrpn_start_serial_reader
+		/// @{
+		/// @brief Read the port in a thread of its own from now until it is closed.
+		/// @throws ReaderFailure, NotOpen
+		void start_reader_thread();
+
+		/// @brief When the last character returned by a read arrived.
+		/// @throws NotOpen
+		struct timeval arrival_time() const;
+
+		/// @brief What to wait on for characters to read.
+		/// @throws NotOpen
+		file_handle_type wake_handle() const;
+		/// @}
+
 		/// @name Serial Port Exceptions
 		/// @{
 		struct AlreadyOpen;
@@ -120,6 +136,7 @@ class VRPN_API vrpn_SerialPort {
 		struct OpenFailure;
 		struct RTSFailure;
 		struct ReadFailure;
+		struct ReaderFailure;
 		struct WriteFailure;
 		/// @}
 
@@ -159,6 +176,10 @@ struct vrpn_SerialPort::ReadFailure : std::runtime_error {
 	ReadFailure() : std::runtime_error("Failure on serial port read.") {}
 };
 
+struct vrpn_SerialPort::ReaderFailure : std::runtime_error {
+	ReaderFailure() : std::runtime_error("Could not start a thread to read serial port.") {}
+};
+
 struct vrpn_SerialPort::WriteFailure : std::runtime_error {
 	WriteFailure() : std::runtime_error("Failure on serial port write.") {}
 };
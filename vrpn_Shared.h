@@ -167,6 +167,10 @@ extern VRPN_API	double vrpn_TimevalMsecs( const struct timeval& tv1 );
 extern VRPN_API	struct timeval vrpn_MsecsTimeval( const double dMsecs );
 extern VRPN_API	void vrpn_SleepMsecs( double dMsecs );
 
+// ftell() and fseek() with 64-bit offsets, for files larger than 2 GB.
+extern VRPN_API	vrpn_int64 vrpn_ftell64( FILE * file );
+extern VRPN_API	int vrpn_fseek64( FILE * file, vrpn_int64 offset, int whence );
+
 //--------------------------------------------------------------
 // vrpn_* buffer util functions and endian-ness related
 // definitions and functions.
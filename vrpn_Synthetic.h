@@ -0,0 +1,159 @@
+#ifndef VRPN_SYNTHETIC_H
+#define VRPN_SYNTHETIC_H
+
+// vrpn_Synthetic
+//
+// Devices that make up reports at a given rate, for finding out how much a
+// server, a network and the clients can take without any hardware.  Unlike
+// vrpn_Tracker_NULL and vrpn_Button_Example_Server, which send the same few
+// messages over and over, these send what real devices of the size asked
+// for would:  trackers with any number of moving sensors, with velocity
+// and acceleration;  analogs with any number of changing channels;  buttons
+// that change several at a time;  and imagers with frames of any size.
+//
+// The rate is kept even when it is higher than the server's loop:  each
+// mainloop() sends every update that has come due since the last one (up
+// to vrpn_SYNTHETIC_MAX_BURST of them;  the rest are skipped, and counted).
+//
+// After the messages of each update, the device sends a "vrpn_Synthetic
+// Stamp" message holding a sequence number and the time the update was
+// sent, so that a client can work out how late the updates arrive and how
+// many went missing (see client_src/vrpn_synthetic_stats.C).  These go in
+// a message of their own rather than in the device messages, whose sizes
+// the remotes check.  The stamps go by the same class of service as the
+// device's messages.
+
+#include "vrpn_Analog.h"                // for vrpn_Analog
+#include "vrpn_Button.h"                // for vrpn_Button_Filter
+#include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Imager.h"                // for vrpn_Imager_Server
+#include "vrpn_Shared.h"                // for timeval
+#include "vrpn_Tracker.h"               // for vrpn_Tracker
+#include "vrpn_Types.h"                 // for vrpn_uint32, vrpn_float64
+
+class VRPN_API vrpn_Connection;
+class VRPN_API vrpn_Poller;
+
+const int vrpn_SYNTHETIC_MAX_BURST = 1000;
+
+extern VRPN_API const char *vrpn_SYNTHETIC_STAMP_TYPE;
+
+// What is in a stamp.
+typedef struct {
+    vrpn_uint32 sequence;       ///< Counts updates from 0
+    vrpn_uint32 messages;       ///< Device messages sent in this update,
+                                ///< counting each tracker pose as one even
+                                ///< when it goes in a frame
+    vrpn_uint32 skipped;        ///< Updates the device has had to skip
+    struct timeval sent;        ///< When the update was sent
+} vrpn_SYNTHETICSTAMP;
+
+// Keeps the time for a synthetic device and sends its stamps.  Each of the
+// devices below has one of these named d_source.
+class VRPN_API vrpn_Synthetic_Source {
+
+  public:
+
+    vrpn_Synthetic_Source (vrpn_float64 Hz);
+
+    /// Registers the stamp message type;  returns -1 on failure.
+    int register_types (vrpn_Connection *c);
+
+    /// How many updates are due now;  now is set to the current time.
+    int due (struct timeval &now);
+
+    /// Wakes the server when the next update is due.
+    void wake (vrpn_Poller &poller) const;
+
+    /// Sends the stamp that follows the messages of one update.
+    int stamp (vrpn_Connection *c, vrpn_int32 sender,
+               const struct timeval &now, vrpn_uint32 messages,
+               vrpn_uint32 class_of_service);
+
+    /// Seconds since the device started, for the motions of its values.
+    double seconds (const struct timeval &now) const;
+
+    /// Decodes a stamp message (for clients).
+    static int decode (const char *buf, vrpn_int32 len,
+                       vrpn_SYNTHETICSTAMP &stamp);
+
+  protected:
+
+    vrpn_float64 d_rate;
+    struct timeval d_start;
+    struct timeval d_next;              ///< When the next update is due
+    vrpn_uint32 d_sequence;
+    vrpn_uint32 d_skipped;
+    vrpn_int32 d_stamp_m_id;
+};
+
+// Sensors going around circles, each its own size and speed, with the
+// velocity and acceleration to match.  The poses of each update go out as
+// one tracker frame to the clients that take frames.
+class VRPN_API vrpn_Tracker_Synthetic: public vrpn_Tracker {
+  public:
+    vrpn_Tracker_Synthetic (const char *name, vrpn_Connection *c,
+                            vrpn_int32 sensors = 1, vrpn_float64 Hz = 60.0);
+    virtual void mainloop ();
+
+    /// Wakes the server when the next update is due.
+    virtual bool wake_sources (vrpn_Poller &poller);
+
+  protected:
+    void move_sensor (int sensor, double t);
+    vrpn_Synthetic_Source d_source;
+};
+
+// Channels each following a sine wave of its own.
+class VRPN_API vrpn_Analog_Synthetic: public vrpn_Analog {
+  public:
+    vrpn_Analog_Synthetic (const char *name, vrpn_Connection *c,
+                           vrpn_int32 channels = 8, vrpn_float64 Hz = 60.0);
+    virtual void mainloop ();
+
+    /// Wakes the server when the next update is due.
+    virtual bool wake_sources (vrpn_Poller &poller);
+
+  protected:
+    vrpn_Synthetic_Source d_source;
+};
+
+// Buttons toggled burst at a time, going around all of them in turn.
+class VRPN_API vrpn_Button_Synthetic: public vrpn_Button_Filter {
+  public:
+    vrpn_Button_Synthetic (const char *name, vrpn_Connection *c,
+                           vrpn_int32 buttons = 16, vrpn_float64 Hz = 10.0,
+                           vrpn_int32 burst = 1);
+    virtual void mainloop ();
+
+    /// Wakes the server when the next update is due.
+    virtual bool wake_sources (vrpn_Poller &poller);
+
+  protected:
+    vrpn_int32 d_burst;
+    vrpn_int32 d_next_button;
+    vrpn_Synthetic_Source d_source;
+};
+
+// 8-bit frames of a moving pattern, sent a region of rows at a time.
+class VRPN_API vrpn_Imager_Synthetic: public vrpn_Imager_Server {
+  public:
+    vrpn_Imager_Synthetic (const char *name, vrpn_Connection *c,
+                           vrpn_int32 cols = 640, vrpn_int32 rows = 480,
+                           vrpn_float64 Hz = 30.0);
+    ~vrpn_Imager_Synthetic ();
+    virtual void mainloop ();
+
+    /// Wakes the server when the next frame is due.
+    virtual bool wake_sources (vrpn_Poller &poller);
+
+  protected:
+    int send_frame (const struct timeval &now);
+
+    vrpn_int16 d_channel;
+    vrpn_uint8 *d_frame;
+    vrpn_uint32 d_frames;
+    vrpn_Synthetic_Source d_source;
+};
+
+#endif  // VRPN_SYNTHETIC_H
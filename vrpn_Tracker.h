@@ -26,9 +26,11 @@
 #include "vrpn_BaseClass.h"             // for vrpn_Callback_List, etc
 #include "vrpn_Configure.h"             // for VRPN_CALLBACK, VRPN_API, etc
 #include "vrpn_Connection.h"
+#include "vrpn_Reset_Steps.h"           // for vrpn_Reset_Steps
 #include "vrpn_Shared.h"                // for timeval
 #include "vrpn_Types.h"                 // for vrpn_float64, vrpn_int32, etc
 
+class VRPN_API vrpn_Frame_Parser;
 class VRPN_API vrpn_RedundantTransmission;
 
 // tracker status flags
@@ -46,6 +48,22 @@ const	int vrpn_ALL_SENSORS = -1;
 typedef vrpn_float64  vrpn_Tracker_Pos[3];
 typedef vrpn_float64  vrpn_Tracker_Quat[4];
 
+// Frames:  a tracker that measures many sensors at once (an optical
+// system with dozens of bodies, say) can send all of their poses for one
+// time in "vrpn_Tracker Pos_Quat_Frame" messages rather than one
+// "vrpn_Tracker Pos_Quat" message each.  Each frame message holds four
+// vrpn_int32s (the count of poses in it, the index in the frame of its
+// first pose, flags and padding) and then the poses, each laid out as in a
+// Pos_Quat message.  A frame of more than vrpn_TRACKER_FRAME_MAX_POSES poses
+// goes in several messages with the same time, the last one flagged
+// vrpn_TRACKER_FRAME_LAST, so that each fits in a UDP packet.  Frames only
+// go to peers running at least minor version vrpn_TRACKER_FRAME_VERSION of
+// VRPN;  older peers, and handlers in the server's own process, get the
+// Pos_Quat messages as before.
+const	int vrpn_TRACKER_FRAME_VERSION = 32;
+const	int vrpn_TRACKER_FRAME_MAX_POSES = 20;
+const	vrpn_int32 vrpn_TRACKER_FRAME_LAST = 1;
+
 class VRPN_API vrpn_Tracker : public vrpn_BaseClass {
   public:
   // vrpn_Tracker.cfg, in the "local" directory, is the default config file
@@ -84,6 +102,7 @@ class VRPN_API vrpn_Tracker : public vrpn_BaseClass {
    vrpn_int32 update_rate_id;		// ID of update rate message
    vrpn_int32 connection_dropped_m_id;	// ID of connection dropped message
    vrpn_int32 reset_origin_m_id;	// ID of reset origin message					
+   vrpn_int32 frame_m_id;		// ID of tracker frame message
 
    // Description of the next report to go out
    vrpn_int32 d_sensor;			// Current sensor
@@ -130,6 +149,29 @@ class VRPN_API vrpn_Tracker : public vrpn_BaseClass {
    virtual int encode_tracker2room_to(char *buf); // Encodes the tracker2room
    virtual int encode_unit2sensor_to(char *buf); // and unit2sensor xforms
    virtual int encode_workspace_to(char *buf); // Encodes workspace info
+
+   // For trackers that measure several sensors at once:  set d_sensor,
+   // pos and d_quat and call pack_frame_pose() for each one, then call
+   // pack_frame_end() once they are all in.  Older peers get each pose
+   // right away;  newer ones get the frame (see vrpn_TRACKER_FRAME_VERSION).
+   // A pose with a different time from the one before ends that frame.
+   // Both return 0 on success and -1 on failure.
+   int pack_frame_pose(const struct timeval &t,
+		       vrpn_uint32 class_of_service = vrpn_CONNECTION_LOW_LATENCY);
+   int pack_frame_end(void);
+
+  private:
+   int pack_frame_part(bool last);
+
+   vrpn_float64 d_frame_buf[(4 * sizeof(vrpn_int32) +
+			     vrpn_TRACKER_FRAME_MAX_POSES * 8 *
+			     sizeof(vrpn_float64)) / sizeof(vrpn_float64)];
+   vrpn_int32 d_frame_poses;		// In d_frame_buf, not yet packed
+   vrpn_int32 d_frame_packed;		// Poses of this frame already packed
+   struct timeval d_frame_time;
+   vrpn_uint32 d_frame_class;
+   bool d_frame_open;			// Poses have come since the last end
+   bool d_frame_wanted;			// Some peer takes frames
 };
 
 #ifndef VRPN_CLIENT_ONLY
@@ -142,11 +184,22 @@ class VRPN_API vrpn_Tracker_Serial : public vrpn_Tracker {
 		const char * port = "/dev/ttyS1", long baud = 38400);
    virtual ~vrpn_Tracker_Serial();
 
+   /// Read the ports of serial trackers opened after this call in threads
+   /// of their own (see vrpn_start_serial_reader()), so that reports can be
+   /// stamped with when they arrived rather than when mainloop() got to
+   /// them.  Off by default.
+   static void use_reader_threads(bool on);
+
   protected:
    char portname[VRPN_TRACKER_BUF_SIZE];
    long baudrate;
    int serial_fd;
 
+   /// Opens portname into serial_fd, with a reader thread if they are on.
+   /// Returns 0 on success and -1 on failure.
+   int open_serial_port(void);
+   static bool d_use_reader_threads;
+
    unsigned char buffer[VRPN_TRACKER_BUF_SIZE];// Characters read in from the tracker so far
    vrpn_uint32 bufcount;		// How many characters in the buffer?
 
@@ -156,12 +209,39 @@ class VRPN_API vrpn_Tracker_Serial : public vrpn_Tracker {
    // Sends the report that was just read.
    virtual void send_report(void);
 
-   /// Reset the tracker.
+   /// Reset the tracker.  This is called from mainloop() while the status
+   /// is vrpn_TRACKER_RESETTING, each time reset_steps says it is ready.
+   /// Drivers that must wait for the tracker do one step per call and
+   /// set when the next is due rather than sleeping;  see vrpn_Reset_Steps.
    virtual void reset(void) = 0;
 
+   /// Where reset() is in its steps and when the next one is due.  It is
+   /// restarted whenever the port is reopened after vrpn_TRACKER_FAIL.
+   vrpn_Reset_Steps reset_steps;
+
+   /// Sends a driver's additional reset commands, for use from one step of
+   /// reset().  The commands come in lines ending with \015;  a line that
+   /// starts with an asterisk (*) is a pause, with the number of seconds
+   /// to wait after it.  Sending starts at offset and stops at the next
+   /// pause, leaving offset past it.  Returns how many milliseconds to wait
+   /// before calling again, or -1 once all of the lines have been sent.
+   double send_reset_commands(const char *commands, int &offset);
+
+   /// For drivers that find their reports with a vrpn_Frame_Parser:
+   /// returns the next complete report, reading what the port has if none
+   /// is waiting, and sets timestamp to when it arrived.  Returns NULL if
+   /// there isn't one yet, or if the read failed (which puts the tracker
+   /// into vrpn_TRACKER_FAIL).
+   const unsigned char *next_frame(vrpn_Frame_Parser &frames, int &len);
+
   public:
    /// Uses the get_report, send_report, and reset routines to implement a server
    virtual void mainloop();
+
+   /// Wakes the server when there are characters to read, when the
+   /// tracker has gone too long without a report, or when the next step
+   /// of a reset (or the next try at reopening the port) is due.
+   virtual bool wake_sources (vrpn_Poller & poller);
 };
 
 // This driver uses the VRPN-preferred LibUSB-1.0 to control the device.
@@ -220,6 +300,9 @@ class VRPN_API vrpn_Tracker_NULL: public vrpn_Tracker {
 	vrpn_int32 sensors = 1, vrpn_float64 Hz = 1.0);
    virtual void mainloop();
 
+   /// Wakes the server when the next report is due.
+   virtual bool wake_sources (vrpn_Poller & poller);
+
    void setRedundantTransmission (vrpn_RedundantTransmission *);
 
   protected:
@@ -265,6 +348,14 @@ class VRPN_API vrpn_Tracker_Server: public vrpn_Tracker {
 			   const vrpn_float64 interval,
 			   const vrpn_uint32 class_of_service = vrpn_CONNECTION_LOW_LATENCY);
 
+   /// Reports the poses of count sensors that were measured at the same
+   /// time, as a frame for the clients that take them and as one report
+   /// per sensor for the rest (see vrpn_TRACKER_FRAME_VERSION).
+   virtual int report_frame(const struct timeval t, const int count,
+			   const int sensors[],
+			   const vrpn_float64 positions[][3],
+			   const vrpn_float64 quaternions[][4],
+			   const vrpn_uint32 class_of_service = vrpn_CONNECTION_LOW_LATENCY);
 };
 
 
@@ -342,6 +433,19 @@ typedef struct _vrpn_TRACKERWORKSPACECB {
 typedef void (VRPN_CALLBACK *vrpn_TRACKERWORKSPACECHANGEHANDLER)(void *userdata,
 					const vrpn_TRACKERWORKSPACECB info);
 
+// This is a new tracker callback type that was added in VRPN 7.32.  It
+// gives all of the poses in a frame (see vrpn_TRACKER_FRAME_VERSION) at
+// once, after the change callbacks have been called for each of them.  It
+// is only called for trackers that send frames, and only for whole frames;
+// the poses are only good until the handler returns.
+typedef struct _vrpn_TRACKERFRAMECB {
+	struct timeval	msg_time;	// Time of the frame
+	vrpn_int32	num_poses;	// How many sensors are in it
+	const vrpn_TRACKERCB *poses;	// One for each of them
+} vrpn_TRACKERFRAMECB;
+typedef void (VRPN_CALLBACK *vrpn_TRACKERFRAMEHANDLER)(void *userdata,
+					const vrpn_TRACKERFRAMECB info);
+
 // Structure to hold all of the callback lists for one sensor
 // (also used for the "all sensors" sensor).
 class vrpn_Tracker_Sensor_Callbacks {
@@ -442,6 +546,16 @@ class VRPN_API vrpn_Tracker_Remote: public vrpn_Tracker {
 	  return d_tracker2roomchange_list.unregister_handler(userdata, handler);
 	};
 
+	// (un)Register a callback handler to handle whole frames
+	virtual int register_frame_handler(void *userdata,
+		vrpn_TRACKERFRAMEHANDLER handler) {
+	  return d_frame_list.register_handler(userdata, handler);
+	};
+	virtual int unregister_frame_handler(void *userdata,
+		vrpn_TRACKERFRAMEHANDLER handler) {
+	  return d_frame_list.unregister_handler(userdata, handler);
+	};
+
   protected:
     // Callbacks with one per sensor (plus one for "all")
     vrpn_Tracker_Sensor_Callbacks   all_sensor_callbacks;
@@ -452,6 +566,17 @@ class VRPN_API vrpn_Tracker_Remote: public vrpn_Tracker {
     // Callbacks that are one per tracker
     vrpn_Callback_List<vrpn_TRACKERTRACKER2ROOMCB>  d_tracker2roomchange_list;
     vrpn_Callback_List<vrpn_TRACKERWORKSPACECB>	    d_workspacechange_list;
+    vrpn_Callback_List<vrpn_TRACKERFRAMECB>	    d_frame_list;
+
+    // The frame being put together from its messages
+    vrpn_TRACKERCB  *d_frame;
+    vrpn_int32      d_frame_count;
+    vrpn_int32      d_frame_room;
+    bool            d_frame_broken;	// A part of it went missing
+    bool  ensure_frame_room(vrpn_int32 num);
+
+    // Calls the change handlers for all sensors and for tp's sensor.
+    int   report_change(const vrpn_TRACKERCB &tp);
 
     static int VRPN_CALLBACK handle_change_message(void *userdata,
 		    vrpn_HANDLERPARAM p);
@@ -465,6 +590,8 @@ class VRPN_API vrpn_Tracker_Remote: public vrpn_Tracker {
                     vrpn_HANDLERPARAM p);
     static int VRPN_CALLBACK handle_workspace_change_message(void *userdata,
 		    vrpn_HANDLERPARAM p);
+    static int VRPN_CALLBACK handle_frame_message(void *userdata,
+		    vrpn_HANDLERPARAM p);
 };
 
 // End of vrpn_TRACKER_H
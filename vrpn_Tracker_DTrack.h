@@ -108,6 +108,15 @@ class VRPN_API vrpn_Tracker_DTrack : public vrpn_Tracker, public vrpn_Button_Fil
 
 	virtual void mainloop();
 
+	/// Wakes the server when a frame arrives from DTrack.
+	virtual bool wake_sources(vrpn_Poller & poller);
+
+	/// Parses one DTrack packet (ASCII protocol) into the body, Flystick and
+	/// marker data that mainloop() reports.  mainloop() calls this for each
+	/// packet it receives; it is public so that recorded packets can be
+	/// replayed through it (see server_src/dtrack_bench.C).
+	bool dtrack_parse(const char* buf, int len);
+
 
  private:
 
@@ -146,6 +155,7 @@ class VRPN_API vrpn_Tracker_DTrack : public vrpn_Tracker, public vrpn_Button_Fil
 	                                int num_but, const int* but, struct timeval timestamp);
 	int dtrack2vrpn_flystickanalogs(int id, int id_dtrack,
 	                                int num_ana, const float* ana, float dt, struct timeval timestamp);
+	void dtrack2vrpn_frame(void);
 
 	// communicating with DTrack:
 	// these functions receive and parse data packets from DTrack
@@ -16,6 +16,7 @@
 #include <stdio.h>                      // for NULL
 
 #include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Frame_Parser.h"          // for vrpn_Frame_Parser
 #include "vrpn_Shared.h"                // for timeval
 #include "vrpn_Tracker.h"               // for vrpn_Tracker_Serial
 #include "vrpn_Types.h"                 // for vrpn_uint32
@@ -74,6 +75,11 @@ class VRPN_API vrpn_Tracker_Fastrak: public vrpn_Tracker_Serial {
   virtual void reset();
 
   struct timeval reset_time;
+  unsigned char reset_string[10];	//< Characters reset() is sending, one at a time
+  int	reset_len;		//< How many characters are in reset_string
+  int	reset_sent;		//< How many of them have been sent so far
+  int	reset_station;		//< Next station whose output format is to be set
+  int	add_reset_offset;	//< Where the next additional reset command starts
   int	do_filter;		//< Should we turn on filtering for pos/orient?
   int	num_stations;		//< How many stations maximum on this Fastrak?
   char	add_reset_cmd[2048];	//< Additional reset commands to be sent
@@ -88,13 +94,18 @@ class VRPN_API vrpn_Tracker_Fastrak: public vrpn_Tracker_Serial {
   struct timeval is900_zerotime;    //< When the IS-900 time counter was zeroed
   vrpn_Button_Server		*is900_buttons[vrpn_FASTRAK_MAX_STATIONS];	//< Pointer to button on each sensor (NULL if none)
   vrpn_Clipping_Analog_Server	*is900_analogs[vrpn_FASTRAK_MAX_STATIONS];	//< Pointer to analog on each sensor (NULL if none)
-  vrpn_uint32	REPORT_LEN;	    //< The length that the current report should be
 
   /// Augments the basic Fastrak format to include IS900 features if needed
   int	set_sensor_output_format(int sensor);
 
   /// Augments the basic Fastrak report length to include IS900 features if needed
   int	report_length(int sensor);
+
+  /// Finds the reports in what is read;  their length depends on the station.
+  vrpn_Frame_Parser d_frames;
+  static vrpn_Frame_Format frame_format(vrpn_Tracker_Fastrak *tracker);
+  static int frame_length(const unsigned char *frame, int have, void *userdata);
+  static bool good_header(const unsigned char *frame, int len, void *userdata);
 };
 
 #endif
@@ -47,6 +47,10 @@ class VRPN_API vrpn_Tracker_FilterOneEuro: public vrpn_Tracker {
 
     virtual void mainloop();
 
+    // Reports come to us through callbacks;  when the tracker we listen to
+    // is on the server connection, there is nothing else to wait for.
+    virtual bool wake_sources(vrpn_Poller & poller);
+
   private:
     int  d_channels;                    // How many channels on our tracker?
     vrpn_OneEuroFilterVec *d_filters;   // Set of position filters, one/channel
@@ -12,6 +12,7 @@
 #include <stdio.h>                      // for NULL
 
 #include "vrpn_Configure.h"             // for VRPN_API
+#include "vrpn_Frame_Parser.h"          // for vrpn_Frame_Parser
 #include "vrpn_Shared.h"                // for timeval
 #include "vrpn_Tracker.h"               // for vrpn_Tracker_Serial
 
@@ -55,6 +56,10 @@ class VRPN_API vrpn_Tracker_Isotrak: public vrpn_Tracker_Serial {
   virtual void reset();
 
   struct timeval reset_time;
+  unsigned char reset_string[10];	//< Characters reset() is sending, one at a time
+  int	reset_len;		//< How many characters are in reset_string
+  int	reset_sent;		//< How many of them have been sent so far
+  int	add_reset_offset;	//< Where the next additional reset command starts
   int	do_filter;		//< Should we turn on filtering for pos/orient?
   int	num_stations;		//< How many stations maximum on this Isotrak?
 
@@ -65,6 +70,10 @@ class VRPN_API vrpn_Tracker_Isotrak: public vrpn_Tracker_Serial {
   // An Isotrak can have stylus's with buttons on them
   vrpn_Button_Server   *stylus_buttons[vrpn_ISOTRAK_MAX_STATIONS];
 
+  vrpn_Frame_Parser d_frames;	//< Finds the binary records in what is read
+  static vrpn_Frame_Format frame_format(vrpn_Tracker_Isotrak *tracker);
+  static bool good_station(const unsigned char *frame, int len, void *userdata);
+
 private:
     void process_binary();
 };
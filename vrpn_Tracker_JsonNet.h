@@ -10,17 +10,16 @@
 #include "vrpn_Tracker.h"
 #include "vrpn_Text.h"
 
-namespace Json {
-	class Reader;
-	class Value;
-}
-
 /**
  * A tracker class that accepts network updates in JSON format.
  *
  * This tracker is used by the Vrpn Android widgets. 
  * Any other application that can send UDP packets with a JSON payload 
  * and feed this tracker.
+ *
+ * A datagram may hold several messages, one after the other or one per
+ * line.  They are read straight out of the receive buffer, without
+ * building a JSON document, and each is reported as it is read.
  * 
  * @Author Philippe Crassous / ENSAM ParisTech-Institut Image
  */
@@ -37,6 +36,15 @@ public:
 
 	void mainloop();
 
+	/// Wakes the server when a packet arrives.
+	bool wake_sources(vrpn_Poller & poller);
+
+	/// Handles the messages in one datagram as if it had arrived at when,
+	/// and returns how many there were that could be used.  mainloop()
+	/// calls this for each datagram it receives;  server_src/jsonnet_bench.C
+	/// calls it to time the parser without a network.
+	int parse_datagram(const char* buffer, int length, const struct timeval& when);
+
 	enum {
 		TILT_TRACKER_ID = 0,
 	};
@@ -56,21 +64,26 @@ private:
 #endif
 	socket_type _socket;
 	enum {
-		_NETWORK_BUFFER_SIZE = 2000,
-
+		_NETWORK_BUFFER_SIZE = 8192,
+		_MAX_DATAGRAMS_PER_LOOP = 64,
 	};
 	char _network_buffer[_NETWORK_BUFFER_SIZE];
 
 	/*
 	 * Json part
 	 */
-	bool _parse(const char* buffer, int length);
-	bool _parse_tracker_data(const Json::Value& root);
-	bool _parse_analog(const Json::Value& root);
-	bool _parse_button(const Json::Value& root);
-	bool _parse_text(const Json::Value& root);
-	bool _do_tracker_report;
-	Json::Reader* _pJsonReader;
+	struct Message;
+	bool _parse_message(const char*& s, const char* end, Message& msg);
+	bool _parse_tracker_data(const Message& msg, const struct timeval& when);
+	bool _parse_analog(const Message& msg);
+	bool _parse_button(const Message& msg, const struct timeval& when);
+	bool _parse_text(const Message& msg, const struct timeval& when);
+
+	/// Unescaped strings from the message being parsed.  Nothing in a
+	/// message is longer than the datagram holding it, so this is as big
+	/// as the receive buffer and is started over for each message.
+	char _arena[_NETWORK_BUFFER_SIZE + 1];
+	int _arena_used;
 };
 
 #endif // ifdef JSONNET
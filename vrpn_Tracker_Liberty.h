@@ -55,6 +55,11 @@ class VRPN_API vrpn_Tracker_Liberty: public vrpn_Tracker_Serial {
   virtual void reset();
 
   struct timeval reset_time;
+  char	reset_string[10];	//< Characters reset() is sending, one at a time
+  int	reset_len;		//< How many characters are in reset_string
+  int	reset_sent;		//< How many of them have been sent so far
+  int	reset_station;		//< Next station whose output format is to be set
+  int	add_reset_offset;	//< Where the next additional reset command starts
   int	do_filter;		//< Should we turn on filtering for pos/orient?
   int	num_stations;		//< How many stations maximum on this Liberty?
   char	add_reset_cmd[2048];	//< Additional reset commands to be sent
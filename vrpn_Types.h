@@ -172,6 +172,14 @@ typedef  double          vrpn_float64;
 #error Need to define architecture-dependent sizes in this file
 #endif
 
+// A 64-bit integer, used for file offsets so that logs larger than 2 GB
+// work even where long is only 32 bits (Windows, 32-bit Unix).
+#ifdef  _MSC_VER
+typedef  __int64         vrpn_int64;
+#else
+typedef  long long       vrpn_int64;
+#endif
+
 // Prevent use of this macro outside this file;
 // if you need to distinguish more types, then define new types in this file.
 
@@ -160,6 +160,10 @@ SOURCE=.\vrpn_Connection.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Device_Thread.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Dial.C
 # End Source File
 # Begin Source File
@@ -220,6 +224,10 @@ SOURCE=.\vrpn_ForwarderController.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Frame_Parser.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_GlobalHapticsOrb.C
 # End Source File
 # Begin Source File
@@ -260,6 +268,14 @@ SOURCE=.\vrpn_LamportClock.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_LogCompression.C
+# End Source File
+# Begin Source File
+
+SOURCE=.\vrpn_LogIndex.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Magellan.C
 # End Source File
 # Begin Source File
@@ -268,6 +284,10 @@ SOURCE=.\vrpn_Mouse.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_MultiFileConnection.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Mutex.C
 # End Source File
 # Begin Source File
@@ -280,6 +300,10 @@ SOURCE=.\vrpn_nikon_controls.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Poller.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Poser.C
 # End Source File
 # Begin Source File
@@ -300,6 +324,10 @@ SOURCE=.\vrpn_RedundantTransmission.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Reset_Steps.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Serial.C
 # End Source File
 # Begin Source File
@@ -320,6 +348,10 @@ SOURCE=.\vrpn_Spaceball.C
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Synthetic.C
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Text.C
 # End Source File
 # Begin Source File
@@ -484,6 +516,10 @@ SOURCE=.\vrpn_Connection.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Device_Thread.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Dial.h
 # End Source File
 # Begin Source File
@@ -540,6 +576,10 @@ SOURCE=.\vrpn_ForwarderController.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Frame_Parser.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_GlobalHapticsOrb.h
 # End Source File
 # Begin Source File
@@ -600,6 +640,10 @@ SOURCE=.\vrpn_nikon_controls.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Poller.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Poser.h
 # End Source File
 # Begin Source File
@@ -620,6 +664,10 @@ SOURCE=.\vrpn_RedundantTransmission.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Reset_Steps.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Serial.h
 # End Source File
 # Begin Source File
@@ -640,6 +688,10 @@ SOURCE=.\vrpn_Spaceball.h
 # End Source File
 # Begin Source File
 
+SOURCE=.\vrpn_Synthetic.h
+# End Source File
+# Begin Source File
+
 SOURCE=.\vrpn_Text.h
 # End Source File
 # Begin Source File